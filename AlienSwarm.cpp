@@ -0,0 +1,405 @@
+/*********************************************************************
+** Program name: AlienSwarm.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 21, 2019 at 3:30 PM
+** Description: Class implementation file for AlienSwarm. AlienSwarm
+ *              holds aliens that roam the surface of the asteroid,
+ *              taking a random step every time the traveler takes
+ *              one. An alien that steps onto the traveler attacks
+ *              them, then rests for a few steps before it can attack
+ *              again. The aliens are stored as separate arrays of
+ *              positions, types, states and cooldowns, so a step
+ *              moves every alien in one tight loop without touching
+ *              the board, and large swarms stay fast. Random steps
+ *              come from a xorshift generator owned by the swarm.
+ *              Aliens can also hunt the traveler, all following one
+ *              shared FlowField toward them. Either way they never
+ *              start on or step onto a cell of the board's
+ *              BlockerMap, the same cells the traveler can't cross.
+*********************************************************************/
+
+
+#include "AlienSwarm.hpp"
+
+//initialize attack constants
+const int AlienSwarm::DAMAGE = 10;
+const int AlienSwarm::REST_STEPS = 3;
+
+//cell offsets for each FlowField step, STAY, UP, RIGHT, DOWN, LEFT
+static const int STEP_X[] = {0, 0, 1, 0, -1};
+static const int STEP_Y[] = {0, -1, 0, 1, 0};
+
+/********************************************************************
+** Function: neighborCell: Moves a cell to its neighbor in a
+ *              direction, or keeps it where it is if that neighbor
+ *              is off the board. Picked without a branch, since the
+ *              direction is often random.
+** Params:   int &x: x-coordinate, updated.
+ *           int &y: y-coordinate, updated.
+ *           int direction: FlowField step to take.
+ *           unsigned width: number of columns of the board.
+ *           unsigned height: number of rows of the board.
+** Returns:  None
+*********************************************************************/
+static inline void neighborCell(int &x, int &y, int direction,
+                                unsigned width, unsigned height)
+{
+    int new_x = x + STEP_X[direction];
+    int new_y = y + STEP_Y[direction];
+
+    bool on_board = (static_cast<unsigned>(new_x) < width)
+                    & (static_cast<unsigned>(new_y) < height);
+    x = on_board ? new_x : x;
+    y = on_board ? new_y : y;
+}
+
+
+/********************************************************************
+** Function: hasOpenCell: Checks if any cell of a blocker map can be
+ *              walked on.
+** Params:   const BlockerMap &blockers: map to check.
+** Returns:  bool: true if at least one cell is open.
+*********************************************************************/
+static bool hasOpenCell(const BlockerMap &blockers)
+{
+    //the bits past the last column are always set, so a word with a
+    // clear bit has an open cell
+    for (int y=0; y<blockers.getRows(); y++)
+    {
+        const std::uint64_t *row = blockers.getRow(y);
+        for (int word=0; word<blockers.getWordsPerRow(); word++)
+        {
+            if (~row[word])
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+
+/********************************************************************
+** Function: Constructor: Places aliens of random types at random
+ *              open cells of the board. They start out resting,
+ *              so none attack on the first step. A board with
+ *              no open cells, or no cells at all, gets no aliens.
+** Params:   const BlockerMap &blockers: cells of the board that
+ *              can't be walked on, kept up to date by the board.
+ *           int count: number of aliens.
+ *           uint32_t seed: seed for the random steps, 0 is
+ *              replaced with 1.
+** Returns:  None
+*********************************************************************/
+AlienSwarm::AlienSwarm(const BlockerMap &blockers, int count, std::uint32_t seed)
+        : rows(blockers.getRows()), cols(blockers.getCols()),
+          random_state(seed ? seed : 1), blockers(blockers),
+          x_coords(count), y_coords(count), types(count),
+          states(count, RESTING), cooldowns(count, REST_STEPS)
+{
+    const int CELLS = rows * cols;
+
+    //there is nowhere to put them
+    if (!hasOpenCell(blockers))
+    {
+        x_coords.clear();
+        y_coords.clear();
+        types.clear();
+        states.clear();
+        cooldowns.clear();
+        return;
+    }
+
+    attackers.reserve(count);
+
+    for (int i=0; i<count; i++)
+    {
+        int cell = static_cast<int>(nextRandom() % CELLS);
+
+        //a blocked cell moves the alien on to the next open one
+        for (int tries=0; tries<CELLS && blockers.isBlocked(cell % cols, cell / cols); tries++)
+        {
+            cell = (cell + 1) % CELLS;
+        }
+
+        x_coords[i] = static_cast<std::int16_t>(cell % cols);
+        y_coords[i] = static_cast<std::int16_t>(cell / cols);
+        types[i] = static_cast<unsigned char>(nextRandom() % GameDefaults::ALIEN_SIZE);
+    }
+}
+
+
+/********************************************************************
+** Function: nextRandom: Advances the xorshift generator.
+** Params:   None
+** Returns:  uint32_t: next random number.
+*********************************************************************/
+std::uint32_t AlienSwarm::nextRandom()
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+
+/********************************************************************
+** Function: step: Moves every alien one cell up, right, down or
+ *              left at random, staying on the board and off blocked
+ *              cells. Resting aliens count down their rest. Roaming
+ *              aliens that land on the target attack it and start
+ *              resting.
+** Params:   int target_x: x-coordinate of the traveler.
+ *           int target_y: y-coordinate of the traveler.
+** Returns:  int: number of aliens that attacked.
+*********************************************************************/
+int AlienSwarm::step(int target_x, int target_y)
+{
+    //work on locals so the loop keeps everything in registers
+    const int COUNT = size();
+    const int BLOCK = 16;
+    std::int16_t *xs = x_coords.data();
+    std::int16_t *ys = y_coords.data();
+    unsigned char *alien_states = states.data();
+    unsigned char *rests = cooldowns.data();
+    std::uint32_t random = random_state;
+    const unsigned WIDTH = cols;
+    const unsigned HEIGHT = rows;
+    const std::uint64_t *map = blockers.getRow(0);
+    const int WORDS = blockers.getWordsPerRow();
+    int next_x[BLOCK];
+    int next_y[BLOCK];
+    std::uint64_t words[BLOCK];
+
+    attackers.clear();
+
+    //each random number gives 16 two-bit directions, one per alien of
+    // a block
+    for (int start=0; start<COUNT; start+=BLOCK)
+    {
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+        std::uint32_t bits = random;
+
+        int end = (start + BLOCK < COUNT) ? start + BLOCK : COUNT;
+        bool any_attack = false;
+
+        //the word of the blocker map each alien would step into is
+        // read for the whole block first, so on large boards the reads
+        // wait on memory together instead of one after another
+        for (int i=start; i<end; i++)
+        {
+            //random UP, RIGHT, DOWN or LEFT
+            int direction = static_cast<int>(bits & 3) + FlowField::UP;
+            bits >>= 2;
+            int x = xs[i];
+            int y = ys[i];
+            neighborCell(x, y, direction, WIDTH, HEIGHT);
+            next_x[i - start] = x;
+            next_y[i - start] = y;
+            words[i - start] = map[y * WORDS + static_cast<unsigned>(x) / BlockerMap::WORD_BITS];
+        }
+
+        for (int i=start; i<end; i++)
+        {
+            //stay put instead of stepping onto a blocked cell
+            int x = next_x[i - start];
+            int y = next_y[i - start];
+            bool blocked = (words[i - start] >> (static_cast<unsigned>(x) % BlockerMap::WORD_BITS)) & 1;
+            x = blocked ? xs[i] : x;
+            y = blocked ? ys[i] : y;
+            xs[i] = static_cast<std::int16_t>(x);
+            ys[i] = static_cast<std::int16_t>(y);
+
+            //count down the rest, an alien roams again once it reaches 0
+            rests[i] = static_cast<unsigned char>(rests[i] - (rests[i] != 0));
+            alien_states[i] = rests[i] ? RESTING : ROAMING;
+
+            any_attack |= !rests[i] & (x == target_x) & (y == target_y);
+        }
+
+        //rare, so the loop above stays free of branches and calls
+        if (any_attack)
+        {
+            attack(start, end, target_x, target_y);
+        }
+    }
+
+    random_state = random;
+    return static_cast<int>(attackers.size());
+}
+
+
+/********************************************************************
+** Function: hunt: Moves every roaming alien one cell closer to the
+ *              target by following a flow field. Resting aliens
+ *              count down their rest and wander at random, staying
+ *              off blocked cells. Roaming aliens that land on the
+ *              target attack it and start resting.
+** Params:   const FlowField &field: distances to the target.
+ *           int target_x: x-coordinate of the traveler.
+ *           int target_y: y-coordinate of the traveler.
+** Returns:  int: number of aliens that attacked.
+*********************************************************************/
+int AlienSwarm::hunt(const FlowField &field, int target_x, int target_y)
+{
+    const int COUNT = size();
+    const int BLOCK = 16;
+    std::int16_t *xs = x_coords.data();
+    std::int16_t *ys = y_coords.data();
+    unsigned char *alien_states = states.data();
+    unsigned char *rests = cooldowns.data();
+    std::uint32_t random = random_state;
+    const unsigned WIDTH = cols;
+    const unsigned HEIGHT = rows;
+    const std::uint64_t *map = blockers.getRow(0);
+    const int WORDS = blockers.getWordsPerRow();
+    int next_x[BLOCK];
+    int next_y[BLOCK];
+    std::uint64_t words[BLOCK];
+
+    attackers.clear();
+
+    for (int start=0; start<COUNT; start+=BLOCK)
+    {
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+        std::uint32_t bits = random;
+
+        int end = (start + BLOCK < COUNT) ? start + BLOCK : COUNT;
+        bool any_attack = false;
+
+        for (int i=start; i<end; i++)
+        {
+            //resting aliens wander, the others head for the target
+            int x = xs[i];
+            int y = ys[i];
+            int direction = rests[i] ? static_cast<int>(bits & 3) + FlowField::UP
+                                     : field.next(x, y);
+            bits >>= 2;
+            neighborCell(x, y, direction, WIDTH, HEIGHT);
+            next_x[i - start] = x;
+            next_y[i - start] = y;
+            words[i - start] = map[y * WORDS + static_cast<unsigned>(x) / BlockerMap::WORD_BITS];
+        }
+
+        for (int i=start; i<end; i++)
+        {
+            //stay put instead of stepping onto a blocked cell
+            int x = next_x[i - start];
+            int y = next_y[i - start];
+            bool blocked = (words[i - start] >> (static_cast<unsigned>(x) % BlockerMap::WORD_BITS)) & 1;
+            x = blocked ? xs[i] : x;
+            y = blocked ? ys[i] : y;
+            xs[i] = static_cast<std::int16_t>(x);
+            ys[i] = static_cast<std::int16_t>(y);
+
+            //count down the rest, an alien roams again once it reaches 0
+            rests[i] = static_cast<unsigned char>(rests[i] - (rests[i] != 0));
+            alien_states[i] = rests[i] ? RESTING : ROAMING;
+
+            any_attack |= !rests[i] & (x == target_x) & (y == target_y);
+        }
+
+        if (any_attack)
+        {
+            attack(start, end, target_x, target_y);
+        }
+    }
+
+    random_state = random;
+    return static_cast<int>(attackers.size());
+}
+
+
+/********************************************************************
+** Function: attack: Lets the roaming aliens of a block that are on
+ *              the target attack it, then run away and rest.
+** Params:   int start: index of the first alien of the block.
+ *           int end: index after the last alien of the block.
+ *           int target_x: x-coordinate of the traveler.
+ *           int target_y: y-coordinate of the traveler.
+** Returns:  None
+*********************************************************************/
+void AlienSwarm::attack(int start, int end, int target_x, int target_y)
+{
+    for (int i=start; i<end; i++)
+    {
+        if (!cooldowns[i] && x_coords[i] == target_x && y_coords[i] == target_y)
+        {
+            attackers.push_back(i);
+            states[i] = RESTING;
+            cooldowns[i] = static_cast<unsigned char>(REST_STEPS);
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: size: Returns how many aliens are in the swarm.
+** Params:   None
+** Returns:  int: number of aliens.
+*********************************************************************/
+int AlienSwarm::size() const
+{
+    return static_cast<int>(x_coords.size());
+}
+
+
+/********************************************************************
+** Function: getX: Returns the x-coordinate of an alien.
+** Params:   int index: index of the alien.
+** Returns:  int: x-coordinate.
+*********************************************************************/
+int AlienSwarm::getX(int index) const
+{
+    return x_coords[index];
+}
+
+
+/********************************************************************
+** Function: getY: Returns the y-coordinate of an alien.
+** Params:   int index: index of the alien.
+** Returns:  int: y-coordinate.
+*********************************************************************/
+int AlienSwarm::getY(int index) const
+{
+    return y_coords[index];
+}
+
+
+/********************************************************************
+** Function: getType: Returns the type of an alien.
+** Params:   int index: index of the alien.
+** Returns:  AlienType: type of the alien.
+*********************************************************************/
+AlienType AlienSwarm::getType(int index) const
+{
+    return static_cast<AlienType>(types[index]);
+}
+
+
+/********************************************************************
+** Function: getState: Returns what an alien is doing.
+** Params:   int index: index of the alien.
+** Returns:  State: ROAMING or RESTING.
+*********************************************************************/
+AlienSwarm::State AlienSwarm::getState(int index) const
+{
+    return static_cast<State>(states[index]);
+}
+
+
+/********************************************************************
+** Function: getAttacker: Returns an alien that attacked on the
+ *              last step.
+** Params:   int index: 0 up to the count returned by step.
+** Returns:  int: index of the alien.
+*********************************************************************/
+int AlienSwarm::getAttacker(int index) const
+{
+    return attackers[index];
+}
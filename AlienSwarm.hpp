@@ -0,0 +1,180 @@
+/*********************************************************************
+** Program name: AlienSwarm.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 21, 2019 at 3:30 PM
+** Description: Class specification file for AlienSwarm. AlienSwarm
+ *              holds aliens that roam the surface of the asteroid,
+ *              taking a random step every time the traveler takes
+ *              one. An alien that steps onto the traveler attacks
+ *              them, then rests for a few steps before it can attack
+ *              again. The aliens are stored as separate arrays of
+ *              positions, types, states and cooldowns, so a step
+ *              moves every alien in one tight loop without touching
+ *              the board, and large swarms stay fast. Random steps
+ *              come from a xorshift generator owned by the swarm.
+ *              Aliens can also hunt the traveler, all following one
+ *              shared FlowField toward them. Either way they never
+ *              start on or step onto a cell of the board's
+ *              BlockerMap, the same cells the traveler can't cross.
+*********************************************************************/
+
+
+#ifndef ALIEN_SWARM_HPP
+#define ALIEN_SWARM_HPP
+
+#include <cstdint>
+#include <vector>
+#include "GameDefaults.hpp"
+#include "FlowField.hpp"
+#include "BlockerMap.hpp"
+
+class AlienSwarm
+{
+public:
+    //what an alien is doing
+    enum State
+    {
+        ROAMING,
+        RESTING
+    };
+
+    //health points an attack takes
+    static const int DAMAGE;
+
+    //steps an alien rests after attacking
+    static const int REST_STEPS;
+
+private:
+    int rows;
+    int cols;
+    std::uint32_t random_state;
+
+    //cells aliens can't start on or step onto, not owned
+    const BlockerMap &blockers;
+
+    //one entry per alien
+    std::vector<std::int16_t> x_coords;
+    std::vector<std::int16_t> y_coords;
+    std::vector<unsigned char> types;
+    std::vector<unsigned char> states;
+    std::vector<unsigned char> cooldowns;
+
+    //aliens that attacked on the last step, reserved for every alien
+    // so steps never allocate
+    std::vector<int> attackers;
+
+
+    /********************************************************************
+    ** Function: nextRandom: Advances the xorshift generator.
+    ** Params:   None
+    ** Returns:  uint32_t: next random number.
+    *********************************************************************/
+    std::uint32_t nextRandom();
+
+
+    /********************************************************************
+    ** Function: attack: Lets the roaming aliens of a block that are on
+     *              the target attack it, then run away and rest.
+    ** Params:   int start: index of the first alien of the block.
+     *           int end: index after the last alien of the block.
+     *           int target_x: x-coordinate of the traveler.
+     *           int target_y: y-coordinate of the traveler.
+    ** Returns:  None
+    *********************************************************************/
+    void attack(int start, int end, int target_x, int target_y);
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor: Places aliens of random types at random
+     *              open cells of the board. They start out resting,
+     *              so none attack on the first step. A board with
+     *              no open cells, or no cells at all, gets no aliens.
+    ** Params:   const BlockerMap &blockers: cells of the board that
+     *              can't be walked on, kept up to date by the board.
+     *           int count: number of aliens.
+     *           uint32_t seed: seed for the random steps, 0 is
+     *              replaced with 1.
+    ** Returns:  None
+    *********************************************************************/
+    AlienSwarm(const BlockerMap &blockers, int count, std::uint32_t seed);
+
+
+    /********************************************************************
+    ** Function: step: Moves every alien one cell up, right, down or
+     *              left at random, staying on the board and off blocked
+     *              cells. Resting aliens count down their rest. Roaming
+     *              aliens that land on the target attack it and start
+     *              resting.
+    ** Params:   int target_x: x-coordinate of the traveler.
+     *           int target_y: y-coordinate of the traveler.
+    ** Returns:  int: number of aliens that attacked.
+    *********************************************************************/
+    int step(int target_x, int target_y);
+
+
+    /********************************************************************
+    ** Function: hunt: Moves every roaming alien one cell closer to the
+     *              target by following a flow field. Resting aliens
+     *              count down their rest and wander at random, staying
+     *              off blocked cells. Roaming aliens that land on the
+     *              target attack it and start resting.
+    ** Params:   const FlowField &field: distances to the target.
+     *           int target_x: x-coordinate of the traveler.
+     *           int target_y: y-coordinate of the traveler.
+    ** Returns:  int: number of aliens that attacked.
+    *********************************************************************/
+    int hunt(const FlowField &field, int target_x, int target_y);
+
+
+    /********************************************************************
+    ** Function: size: Returns how many aliens are in the swarm.
+    ** Params:   None
+    ** Returns:  int: number of aliens.
+    *********************************************************************/
+    int size() const;
+
+
+    /********************************************************************
+    ** Function: getX: Returns the x-coordinate of an alien.
+    ** Params:   int index: index of the alien.
+    ** Returns:  int: x-coordinate.
+    *********************************************************************/
+    int getX(int index) const;
+
+
+    /********************************************************************
+    ** Function: getY: Returns the y-coordinate of an alien.
+    ** Params:   int index: index of the alien.
+    ** Returns:  int: y-coordinate.
+    *********************************************************************/
+    int getY(int index) const;
+
+
+    /********************************************************************
+    ** Function: getType: Returns the type of an alien.
+    ** Params:   int index: index of the alien.
+    ** Returns:  AlienType: type of the alien.
+    *********************************************************************/
+    AlienType getType(int index) const;
+
+
+    /********************************************************************
+    ** Function: getState: Returns what an alien is doing.
+    ** Params:   int index: index of the alien.
+    ** Returns:  State: ROAMING or RESTING.
+    *********************************************************************/
+    State getState(int index) const;
+
+
+    /********************************************************************
+    ** Function: getAttacker: Returns an alien that attacked on the
+     *              last step.
+    ** Params:   int index: 0 up to the count returned by step.
+    ** Returns:  int: index of the alien.
+    *********************************************************************/
+    int getAttacker(int index) const;
+
+};
+
+#endif
@@ -0,0 +1,172 @@
+/*********************************************************************
+** Program name: AllocCounter.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 16, 2019 at 9:30 AM
+** Description: Class implementation file for AllocCounter.
+ *              AllocCounter has static functions to check that a
+ *              turn of the game loop does not allocate memory on the
+ *              heap. When the game is built with ALLOC_CHECK defined
+ *              (make ALLOC_CHECK=1), the global operator new is
+ *              replaced by one that counts every allocation, and
+ *              endTurn() stops the program if the turn allocated
+ *              anything. In a normal build nothing is counted and
+ *              the turn checks never fail.
+*********************************************************************/
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include "AllocCounter.hpp"
+
+//number of allocations since the turn began
+static long allocations = 0;
+
+//number of pauses that haven't been resumed yet
+static int pauses = 0;
+
+#ifdef ALLOC_CHECK
+
+/********************************************************************
+** Function: countedAllocate: Allocates memory with malloc and counts
+ *              the allocation unless counting is paused, following
+ *              the rules of operator new.
+** Params:   size_t size: number of bytes to allocate.
+** Returns:  void *: the allocated memory, or nullptr if it failed.
+*********************************************************************/
+static void *countedAllocate(std::size_t size)
+{
+    allocations += (pauses == 0);
+    return std::malloc(size ? size : 1);
+}
+
+void *operator new(std::size_t size)
+{
+    void *memory = countedAllocate(size);
+    if (!memory)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    return countedAllocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    return countedAllocate(size);
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, const std::nothrow_t &) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory, const std::nothrow_t &) noexcept
+{
+    std::free(memory);
+}
+
+#endif
+
+/********************************************************************
+** Function: beginTurn: Starts counting allocations for a turn.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void AllocCounter::beginTurn()
+{
+    allocations = 0;
+}
+
+
+/********************************************************************
+** Function: endTurn: Stops counting allocations for a turn. If the
+ *              turn allocated any memory, prints how many times and
+ *              aborts the program.
+** Params:   int turn: number of the turn, used in the report.
+** Returns:  None
+*********************************************************************/
+void AllocCounter::endTurn(int turn)
+{
+    if (allocations > 0)
+    {
+        std::fprintf(stderr, "ALLOC_CHECK: turn %d made %ld heap allocation(s)\n",
+                turn, allocations);
+        std::abort();
+    }
+}
+
+
+/********************************************************************
+** Function: pause: Stops counting allocations until resume is
+ *              called, for rare world events that have to create
+ *              new objects, such as a meteor shower replacing
+ *              tiles. Pauses can be nested.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void AllocCounter::pause()
+{
+    pauses++;
+}
+
+
+/********************************************************************
+** Function: resume: Counts allocations again after pause.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void AllocCounter::resume()
+{
+    if (pauses > 0)
+    {
+        pauses--;
+    }
+}
+
+
+/********************************************************************
+** Function: getCount: Returns the number of allocations counted
+ *              since the current turn began.
+** Params:   None
+** Returns:  long: number of allocations, always 0 unless built
+ *              with ALLOC_CHECK.
+*********************************************************************/
+long AllocCounter::getCount()
+{
+    return allocations;
+}
+
+
+/********************************************************************
+** Function: isEnabled: Checks if allocations are being counted.
+** Params:   None
+** Returns:  bool: true if built with ALLOC_CHECK.
+*********************************************************************/
+bool AllocCounter::isEnabled()
+{
+#ifdef ALLOC_CHECK
+    return true;
+#else
+    return false;
+#endif
+}
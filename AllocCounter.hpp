@@ -0,0 +1,80 @@
+/*********************************************************************
+** Program name: AllocCounter.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 16, 2019 at 9:30 AM
+** Description: Class specification file for AllocCounter.
+ *              AllocCounter has static functions to check that a
+ *              turn of the game loop does not allocate memory on the
+ *              heap. When the game is built with ALLOC_CHECK defined
+ *              (make ALLOC_CHECK=1), the global operator new is
+ *              replaced by one that counts every allocation, and
+ *              endTurn() stops the program if the turn allocated
+ *              anything. In a normal build nothing is counted and
+ *              the turn checks never fail.
+*********************************************************************/
+
+
+#ifndef ALLOC_COUNTER_HPP
+#define ALLOC_COUNTER_HPP
+
+class AllocCounter
+{
+public:
+
+    /********************************************************************
+    ** Function: beginTurn: Starts counting allocations for a turn.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void beginTurn();
+
+
+    /********************************************************************
+    ** Function: endTurn: Stops counting allocations for a turn. If the
+     *              turn allocated any memory, prints how many times and
+     *              aborts the program.
+    ** Params:   int turn: number of the turn, used in the report.
+    ** Returns:  None
+    *********************************************************************/
+    static void endTurn(int turn);
+
+
+    /********************************************************************
+    ** Function: pause: Stops counting allocations until resume is
+     *              called, for rare world events that have to create
+     *              new objects, such as a meteor shower replacing
+     *              tiles. Pauses can be nested.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void pause();
+
+
+    /********************************************************************
+    ** Function: resume: Counts allocations again after pause.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void resume();
+
+
+    /********************************************************************
+    ** Function: getCount: Returns the number of allocations counted
+     *              since the current turn began.
+    ** Params:   None
+    ** Returns:  long: number of allocations, always 0 unless built
+     *              with ALLOC_CHECK.
+    *********************************************************************/
+    static long getCount();
+
+
+    /********************************************************************
+    ** Function: isEnabled: Checks if allocations are being counted.
+    ** Params:   None
+    ** Returns:  bool: true if built with ALLOC_CHECK.
+    *********************************************************************/
+    static bool isEnabled();
+
+};
+
+#endif
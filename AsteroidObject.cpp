@@ -13,14 +13,15 @@
 
 #include "AsteroidObject.hpp"
 
-using std::cout;
 using std::endl;
 using std::string;
 
+//initialize no alien marker, past the last AlienType
+const unsigned char AsteroidObject::NO_ALIEN = 0xFF;
+
 /********************************************************************
 ** Function: Constructor/default: Sets coordinates, type, description
- *              and icon. Sets treasure, has alien, and alien to
- *              defaults.
+ *              and icon. Sets treasure and alien to defaults.
 ** Params:   int x: x-coordinate of this space.
  *              default = 0.
  *           int y: y-coordinate of this space.
@@ -36,7 +37,7 @@ using std::string;
 AsteroidObject::AsteroidObject(int x, int y, SpaceType type,
                                 string description, char icon)
                 : Space(x, y, type, description, icon),
-                treasure(nullptr), has_alien(false), alien("")
+                has_treasure(false), alien(NO_ALIEN)
 {}
 
 
@@ -58,44 +59,41 @@ bool AsteroidObject::interact(Human *traveler)
     if (traveler)
     {
         //check for alien
-        if (has_alien)
+        if (hasAlien())
         {
             //initialize damage amount
             const int DAMAGE = 10;
 
             //you got attacked by an alien
-            cout << "Uh-oh! You just got attacked by a "
-                 << alien << endl;
-            cout << "..." << endl;
-            cout << "You lost 10 health points!" << endl;
-            cout << "..." << endl;
-            cout << "The alien ran away." << endl;
+            IOBackend::out() << "Uh-oh! You just got attacked by a "
+                 << ALIEN_DESC_LT[alien].description << endl;
+            IOBackend::out() << "..." << endl;
+            IOBackend::out() << "You lost 10 health points!" << endl;
+            IOBackend::out() << "..." << endl;
+            IOBackend::out() << "The alien ran away." << endl;
 
             //deduct health points
             traveler->setHealth(traveler->getHealth() - DAMAGE);
 
             //alien ran away
-            has_alien = false;
+            alien = NO_ALIEN;
         }
         //check for treasure
         else if (hasTreasure())
         {
             //print that you found treasure
-            cout << "You found a "
-                 << treasure->getName()
+            IOBackend::out() << "You found a "
+                 << treasure.getName()
                  << "!" << endl;
 
             //move treasure to your inventory
             traveler->addInventory(getTreasure());
-
-            //set treasure to nullptr
-            treasure = nullptr;
         }
         //no alien or treasure
         else
         {
             //print that there's nothing there
-            cout << "There's nothing there... " << endl;
+            IOBackend::out() << "There's nothing there... " << endl;
         }
     }
 
@@ -105,59 +103,72 @@ bool AsteroidObject::interact(Human *traveler)
 
 /********************************************************************
 ** Function: hasTreasure: Checks if this space has a hidden item.
- *              This function is also used in the destructor for the
- *              Game class to deallocate stray item pointers.
 ** Params:   None
 ** Returns:  bool: True if this space has an item, false otherwise.
 *********************************************************************/
 bool AsteroidObject::hasTreasure() const
 {
-    return treasure != nullptr;
+    return has_treasure;
+}
+
+
+/********************************************************************
+** Function: hasAlien: Checks if an alien is hiding in this space.
+** Params:   None
+** Returns:  bool: True if an alien is hiding here, false otherwise.
+*********************************************************************/
+bool AsteroidObject::hasAlien() const
+{
+    return alien != NO_ALIEN;
 }
 
 
 /********************************************************************
-** Function: getTreasure: Returns pointer to treasure item.
- *              Sets treasure to nullptr.
+** Function: getAlien: Returns the type of the alien hiding here.
 ** Params:   None
-** Returns:  Item *: Pointer to treasure item.
+** Returns:  AlienType: type of the alien, only meaningful if
+ *              hasAlien is true.
 *********************************************************************/
-Item *AsteroidObject::getTreasure()
+AlienType AsteroidObject::getAlien() const
 {
-    //cache item
-    Item *treasure_out = treasure;
+    return static_cast<AlienType>(alien);
+}
 
-    //point treasure to nullptr
-    treasure = nullptr;
+
+/********************************************************************
+** Function: getTreasure: Returns the treasure item and removes it
+ *              from this space.
+** Params:   None
+** Returns:  Item: the treasure item.
+*********************************************************************/
+Item AsteroidObject::getTreasure()
+{
+    //the item leaves this space
+    has_treasure = false;
 
     //return the item
-    return treasure_out;
+    return treasure;
 }
 
 
 /********************************************************************
-** Function: setTreasure: Sets an item pointer to treasure to hide
- *              an item in this space.
-** Params:   Item * treasure: Pointer to item to hide in this space.
+** Function: setTreasure: Hides an item in this space.
+** Params:   Item treasure: item to hide in this space.
 ** Returns:  None
 *********************************************************************/
-void AsteroidObject::setTreasure(Item *treasure)
+void AsteroidObject::setTreasure(Item treasure)
 {
     this->treasure = treasure;
+    has_treasure = true;
 }
 
 
 /********************************************************************
-** Function: setAlien: Sets the alien's description and has_alien
- *              flag to true.
-** Params:   string description: Description of the alien.
+** Function: setAlien: Hides an alien of the given type here.
+** Params:   AlienType type: type of the alien.
 ** Returns:  None
 *********************************************************************/
-void AsteroidObject::setAlien(std::string description)
+void AsteroidObject::setAlien(AlienType type)
 {
-    //set alien description
-    alien = description;
-
-    //set has alien flag to true
-    has_alien = true;
+    alien = static_cast<unsigned char>(type);
 }
@@ -22,16 +22,21 @@
 class AsteroidObject : public Space
 {
 protected:
-    Item *treasure;
-    bool has_alien;
-    std::string alien;
+    Item treasure;
+    bool has_treasure;
+
+    //AlienType of the alien hiding here, the description is looked up
+    // in ALIEN_DESC_LT when it attacks
+    unsigned char alien;
+
+    //alien value of a space with no alien
+    static const unsigned char NO_ALIEN;
 
 public:
 
     /********************************************************************
     ** Function: Constructor/default: Sets coordinates, type, description
-     *              and icon. Sets treasure, has alien, and alien to
-     *              defaults.
+     *              and icon. Sets treasure and alien to defaults.
     ** Params:   int x: x-coordinate of this space.
      *              default = 0.
      *           int y: y-coordinate of this space.
@@ -69,8 +74,6 @@ public:
 
     /********************************************************************
     ** Function: hasTreasure: Checks if this space has a hidden item.
-     *              This function is also used in the destructor for the
-     *              Game class to deallocate stray item pointers.
     ** Params:   None
     ** Returns:  bool: True if this space has an item, false otherwise.
     *********************************************************************/
@@ -78,30 +81,45 @@ public:
 
 
     /********************************************************************
-    ** Function: getTreasure: Returns pointer to treasure item.
-     *              Sets treasure to nullptr.
+    ** Function: hasAlien: Checks if an alien is hiding in this space.
+    ** Params:   None
+    ** Returns:  bool: True if an alien is hiding here, false otherwise.
+    *********************************************************************/
+    bool hasAlien() const;
+
+
+    /********************************************************************
+    ** Function: getAlien: Returns the type of the alien hiding here.
+    ** Params:   None
+    ** Returns:  AlienType: type of the alien, only meaningful if
+     *              hasAlien is true.
+    *********************************************************************/
+    AlienType getAlien() const;
+
+
+    /********************************************************************
+    ** Function: getTreasure: Returns the treasure item and removes it
+     *              from this space.
     ** Params:   None
-    ** Returns:  Item *: Pointer to treasure item.
+    ** Returns:  Item: the treasure item.
     *********************************************************************/
-    Item *getTreasure();
+    Item getTreasure();
 
 
     /********************************************************************
-    ** Function: setTreasure: Sets an item pointer to treasure to hide
-     *              an item in this space.
-    ** Params:   Item * treasure: Pointer to item to hide in this space.
+    ** Function: setTreasure: Hides an item in this space.
+    ** Params:   Item treasure: item to hide in this space.
     ** Returns:  None
     *********************************************************************/
-    void setTreasure(Item *treasure);
+    void setTreasure(Item treasure);
 
 
     /********************************************************************
-    ** Function: setAlien: Sets the alien's description and has_alien
-     *              flag to true.
-    ** Params:   string description: Description of the alien.
+    ** Function: setAlien: Hides an alien of the given type here.
+    ** Params:   AlienType type: type of the alien.
     ** Returns:  None
     *********************************************************************/
-    void setAlien(std::string description);
+    void setAlien(AlienType type);
 
 };
 
@@ -0,0 +1,114 @@
+/*********************************************************************
+** Program name: BlockerMap.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 27, 2019 at 11:15 AM
+** Description: Class implementation file for BlockerMap. BlockerMap
+ *              keeps one bit per cell of the board, set for cells
+ *              that can't be walked on, such as chasms and empty
+ *              cells. Each row is its own run of 64-bit words, like
+ *              the explored set of FogOfWar, so a whole row can be
+ *              scanned for the next blocked cell a word at a time.
+ *              Every row has at least one blocked bit past the last
+ *              column, and the rows just above and below the board
+ *              are fully blocked, so a scan along a row always stops
+ *              at the edge of the board without a bounds check.
+*********************************************************************/
+
+
+#include <cstddef>
+#include "BlockerMap.hpp"
+
+using std::uint64_t;
+
+/********************************************************************
+** Function: Constructor/default: Creates a map where every cell
+ *              is blocked, like a board before its spaces are set.
+** Params:   int rows: number of rows of the board.
+ *              default = 0.
+ *           int cols: number of columns of the board.
+ *              default = 0.
+** Returns:  None
+*********************************************************************/
+BlockerMap::BlockerMap(int rows, int cols)
+        : rows(rows), cols(cols),
+          words_per_row(cols / WORD_BITS + 1),
+          bits(static_cast<std::size_t>(rows + 2) * words_per_row, ~0ULL)
+{}
+
+
+/********************************************************************
+** Function: setBlocked: Marks a cell as blocked or open.
+** Params:   int x: x-coordinate of the cell.
+ *           int y: y-coordinate of the cell.
+ *           bool is_blocked: true if the cell can't be walked on.
+** Returns:  None
+*********************************************************************/
+void BlockerMap::setBlocked(int x, int y, bool is_blocked)
+{
+    uint64_t &word = bits[static_cast<std::size_t>(y + 1) * words_per_row + x / WORD_BITS];
+    uint64_t bit = 1ULL << (x % WORD_BITS);
+
+    word = is_blocked ? (word | bit) : (word & ~bit);
+}
+
+
+/********************************************************************
+** Function: isBlocked: Checks if a cell can't be walked on.
+** Params:   int x: x-coordinate of the cell.
+ *           int y: y-coordinate of the cell.
+** Returns:  bool: true if the cell is blocked or off the board.
+*********************************************************************/
+bool BlockerMap::isBlocked(int x, int y) const
+{
+    if (x < 0 || x >= cols || y < 0 || y >= rows)
+    {
+        return true;
+    }
+
+    return (getRow(y)[x / WORD_BITS] >> (x % WORD_BITS)) & 1;
+}
+
+
+/********************************************************************
+** Function: getRow: Returns the words of one row. Bit x % 64 of
+ *              word x / 64 is set if column x is blocked.
+** Params:   int y: row to get, from -1 up to the number of rows.
+** Returns:  const uint64_t *: first word of the row.
+*********************************************************************/
+const uint64_t *BlockerMap::getRow(int y) const
+{
+    return &bits[static_cast<std::size_t>(y + 1) * words_per_row];
+}
+
+
+/********************************************************************
+** Function: getWordsPerRow: Returns how many words each row has.
+** Params:   None
+** Returns:  int: words per row, always more than cols / 64.
+*********************************************************************/
+int BlockerMap::getWordsPerRow() const
+{
+    return words_per_row;
+}
+
+
+/********************************************************************
+** Function: getRows: Returns number of rows.
+** Params:   None
+** Returns:  int: number of rows.
+*********************************************************************/
+int BlockerMap::getRows() const
+{
+    return rows;
+}
+
+
+/********************************************************************
+** Function: getCols: Returns number of columns.
+** Params:   None
+** Returns:  int: number of columns.
+*********************************************************************/
+int BlockerMap::getCols() const
+{
+    return cols;
+}
@@ -0,0 +1,105 @@
+/*********************************************************************
+** Program name: BlockerMap.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 27, 2019 at 11:15 AM
+** Description: Class specification file for BlockerMap. BlockerMap
+ *              keeps one bit per cell of the board, set for cells
+ *              that can't be walked on, such as chasms and empty
+ *              cells. Each row is its own run of 64-bit words, like
+ *              the explored set of FogOfWar, so a whole row can be
+ *              scanned for the next blocked cell a word at a time.
+ *              Every row has at least one blocked bit past the last
+ *              column, and the rows just above and below the board
+ *              are fully blocked, so a scan along a row always stops
+ *              at the edge of the board without a bounds check.
+*********************************************************************/
+
+
+#ifndef BLOCKER_MAP_HPP
+#define BLOCKER_MAP_HPP
+
+#include <cstdint>
+#include <vector>
+
+class BlockerMap
+{
+public:
+    //bits per word of a row
+    enum {WORD_BITS = 64};
+
+private:
+    int rows;
+    int cols;
+    int words_per_row;
+
+    //rows of words, from the row above the board to the one below it
+    std::vector<std::uint64_t> bits;
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Creates a map where every cell
+     *              is blocked, like a board before its spaces are set.
+    ** Params:   int rows: number of rows of the board.
+     *              default = 0.
+     *           int cols: number of columns of the board.
+     *              default = 0.
+    ** Returns:  None
+    *********************************************************************/
+    BlockerMap(int rows = 0, int cols = 0);
+
+
+    /********************************************************************
+    ** Function: setBlocked: Marks a cell as blocked or open.
+    ** Params:   int x: x-coordinate of the cell.
+     *           int y: y-coordinate of the cell.
+     *           bool is_blocked: true if the cell can't be walked on.
+    ** Returns:  None
+    *********************************************************************/
+    void setBlocked(int x, int y, bool is_blocked);
+
+
+    /********************************************************************
+    ** Function: isBlocked: Checks if a cell can't be walked on.
+    ** Params:   int x: x-coordinate of the cell.
+     *           int y: y-coordinate of the cell.
+    ** Returns:  bool: true if the cell is blocked or off the board.
+    *********************************************************************/
+    bool isBlocked(int x, int y) const;
+
+
+    /********************************************************************
+    ** Function: getRow: Returns the words of one row. Bit x % 64 of
+     *              word x / 64 is set if column x is blocked.
+    ** Params:   int y: row to get, from -1 up to the number of rows.
+    ** Returns:  const uint64_t *: first word of the row.
+    *********************************************************************/
+    const std::uint64_t *getRow(int y) const;
+
+
+    /********************************************************************
+    ** Function: getWordsPerRow: Returns how many words each row has.
+    ** Params:   None
+    ** Returns:  int: words per row, always more than cols / 64.
+    *********************************************************************/
+    int getWordsPerRow() const;
+
+
+    /********************************************************************
+    ** Function: getRows: Returns number of rows.
+    ** Params:   None
+    ** Returns:  int: number of rows.
+    *********************************************************************/
+    int getRows() const;
+
+
+    /********************************************************************
+    ** Function: getCols: Returns number of columns.
+    ** Params:   None
+    ** Returns:  int: number of columns.
+    *********************************************************************/
+    int getCols() const;
+
+};
+
+#endif
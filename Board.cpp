@@ -11,14 +11,28 @@
  *              a ground tile, a crater tile, a space rock tile, or
  *              a rocket ship tile. Each Space tile will have four
  *              pointers that link it to its adjacent neighboring
- *              tile.
+ *              tile. The type of each cell is also kept in a compact
+ *              array, so it can be read without following pointers,
+ *              and the cells that can't be walked on are kept in a
+ *              BlockerMap, one bit per cell.
+ *              Tiles can be changed while playing by applying a
+ *              TileBatch, which makes every change, links the new
+ *              spaces, and tells the listeners and the dirty region
+ *              once for the whole batch.
 *********************************************************************/
 
 
+#include <algorithm>
+#include <cstring>
 #include "Board.hpp"
+#include "AsteroidObject.hpp"
 
-using std::cout;
-using std::endl;
+using std::ostream;
+using std::max;
+using std::min;
+
+//dirty region with no cells in it
+static const Board::Region NO_REGION = {0, 0, -1, -1};
 
 /********************************************************************
 ** Function: Constructor/default: Creates a Board instance,
@@ -30,7 +44,9 @@ using std::endl;
  *              default = 0.
 ** Returns:  None
 *********************************************************************/
-Board::Board(int rows, int cols) : rows(rows), cols(cols)
+Board::Board(int rows, int cols) : rows(rows), cols(cols),
+        tile_types(rows * cols, DEFAULTSPACE), blockers(rows, cols), dirty(NO_REGION),
+        fog(nullptr), theme(nullptr)
 {
     //make array of rows for the board
     board = new Space**[rows];
@@ -49,6 +65,9 @@ Board::Board(int rows, int cols) : rows(rows), cols(cols)
             board[y][x] = nullptr;
         }
     }
+
+    //size the row buffer up front so the first frame doesn't allocate
+    row_buffer.resize(Theme::plain().getMaxCellLength() * cols + 2);
 }
 
 
@@ -138,7 +157,42 @@ void Board::linkSpaces()
 
 
 /********************************************************************
-** Function: setSpace: Sets a cell to point to a Space object.
+** Function: linkCell: Links a space to its adjacent neighboring
+ *              cells, and links them back to it.
+** Params:   int x: x-coordinate of the space.
+ *           int y: y-coordinate of the space.
+** Returns:  None
+*********************************************************************/
+void Board::linkCell(int x, int y)
+{
+    Space *space = board[y][x];
+
+    if (y != 0)
+    {
+        space->setTop(board[y-1][x]);
+        board[y-1][x]->setBottom(space);
+    }
+    if (x != cols-1)
+    {
+        space->setRight(board[y][x+1]);
+        board[y][x+1]->setLeft(space);
+    }
+    if (y != rows-1)
+    {
+        space->setBottom(board[y+1][x]);
+        board[y+1][x]->setTop(space);
+    }
+    if (x != 0)
+    {
+        space->setLeft(board[y][x-1]);
+        board[y][x-1]->setRight(space);
+    }
+}
+
+
+/********************************************************************
+** Function: setSpace: Sets a cell to point to a Space object and
+ *              records its type and if it can be walked on.
 ** Params:   int x: x-coordinate of space to set.
  *           int y: y-coordinate of space to set.
  *           Space *space: pointer to space object to add to cell.
@@ -146,13 +200,207 @@ void Board::linkSpaces()
 *********************************************************************/
 void Board::setSpace(int x, int y, Space *space)
 {
+    SpaceType type = space ? space->getType() : DEFAULTSPACE;
+
     board[y][x] = space;
+    tile_types[y * cols + x] = static_cast<unsigned char>(type);
+    blockers.setBlocked(x, y, !SPACE_CONFIG_LT[type].passable);
+}
+
+
+/********************************************************************
+** Function: applyCell: Makes one change of a batch to one cell.
+ *              Replaced spaces are deleted.
+** Params:   const TileBatch::Change &change: the change.
+ *           int x: x-coordinate of the cell.
+ *           int y: y-coordinate of the cell.
+ *           bool &relink: set to true if the space was replaced.
+** Returns:  bool: true if the cell changed.
+*********************************************************************/
+bool Board::applyCell(const TileBatch::Change &change, int x, int y, bool &relink)
+{
+    int current = tile_types[y * cols + x];
+
+    if (change.kind == TileBatch::BURY_ITEM)
+    {
+        //only craters and space rocks can hide items, one at a time
+        AsteroidObject *landmark = dynamic_cast<AsteroidObject*>(board[y][x]);
+        if (!landmark || landmark->hasTreasure())
+        {
+            return false;
+        }
+        landmark->setTreasure(Item(static_cast<ItemType>(change.value)));
+        return true;
+    }
+
+    //leave cells that are already the new type or not the old one,
+    // and the ship and worm holes, which the game keeps track of
+    if (current == change.value
+        || (change.from != TileBatch::ANY_TYPE && current != change.from)
+        || current == ROCKETSHIP || current == WORMHOLE)
+    {
+        return false;
+    }
+
+    //the new space starts out with nothing hidden in it, and a type
+    // the factory can't make leaves the cell alone
+    Space *created = SpaceFactory::create(x, y, static_cast<SpaceType>(change.value));
+    if (!created)
+    {
+        return false;
+    }
+    Space *replaced = board[y][x];
+    setSpace(x, y, created);
+    delete replaced;
+
+    relink = true;
+    return true;
+}
+
+
+/********************************************************************
+** Function: apply: Makes every change of a batch, skipping cells
+ *              that are off the board and the ship and worm hole
+ *              cells, which the game links up. Replaced spaces
+ *              are deleted and the new ones are linked to their
+ *              neighbors. Then the dirty region grows to cover the
+ *              changed cells and every listener is told once. Only
+ *              apply batches to a board that owns its spaces, such
+ *              as the game board, not a TiledBoard.
+** Params:   const TileBatch &batch: changes to make.
+** Returns:  int: number of cells that changed.
+*********************************************************************/
+int Board::apply(const TileBatch &batch)
+{
+    Region touched = NO_REGION;
+    int changed = 0;
+    bool relink = false;
+
+    for (int i=0; i<batch.size(); i++)
+    {
+        const TileBatch::Change &change = batch.getChange(i);
+
+        //only the part of the change that is on the board
+        int left = max(change.left, 0);
+        int top = max(change.top, 0);
+        int right = min(change.right, cols - 1);
+        int bottom = min(change.bottom, rows - 1);
+
+        for (int y=top; y<=bottom; y++)
+        {
+            for (int x=left; x<=right; x++)
+            {
+                if (applyCell(change, x, y, relink))
+                {
+                    //grow the changed region to cover this cell
+                    if (changed++ == 0)
+                    {
+                        touched.left = touched.right = x;
+                        touched.top = touched.bottom = y;
+                    }
+                    touched.left = min(touched.left, x);
+                    touched.top = min(touched.top, y);
+                    touched.right = max(touched.right, x);
+                    touched.bottom = max(touched.bottom, y);
+                }
+            }
+        }
+    }
+
+    if (changed == 0)
+    {
+        return 0;
+    }
+
+    //link the new spaces once every change is made, so spaces
+    // replaced next to each other end up linked to each other
+    if (relink)
+    {
+        for (int y=touched.top; y<=touched.bottom; y++)
+        {
+            for (int x=touched.left; x<=touched.right; x++)
+            {
+                linkCell(x, y);
+            }
+        }
+    }
+
+    //grow the dirty region to cover the batch
+    if (dirty.right < dirty.left)
+    {
+        dirty = touched;
+    }
+    else
+    {
+        dirty.left = min(dirty.left, touched.left);
+        dirty.top = min(dirty.top, touched.top);
+        dirty.right = max(dirty.right, touched.right);
+        dirty.bottom = max(dirty.bottom, touched.bottom);
+    }
+
+    //tell every listener once for the whole batch
+    for (std::size_t i=0; i<listeners.size(); i++)
+    {
+        listeners[i]->tilesChanged(*this, touched.left, touched.top,
+                                   touched.right, touched.bottom);
+    }
+
+    return changed;
+}
+
+
+/********************************************************************
+** Function: addListener: Adds a listener to tell about batches.
+** Params:   BoardListener *listener: listener to add, not owned.
+** Returns:  None
+*********************************************************************/
+void Board::addListener(BoardListener *listener)
+{
+    listeners.push_back(listener);
+}
+
+
+/********************************************************************
+** Function: removeListener: Stops telling a listener about batches.
+** Params:   BoardListener *listener: listener to remove.
+** Returns:  None
+*********************************************************************/
+void Board::removeListener(BoardListener *listener)
+{
+    listeners.erase(std::remove(listeners.begin(), listeners.end(), listener),
+                    listeners.end());
+}
+
+
+/********************************************************************
+** Function: getDirty: Returns the cells changed by batches since
+ *              the dirty region was last cleared, so a renderer
+ *              only has to redraw those.
+** Params:   None
+** Returns:  Region: changed cells, empty if none changed.
+*********************************************************************/
+Board::Region Board::getDirty() const
+{
+    return dirty;
+}
+
+
+/********************************************************************
+** Function: clearDirty: Empties the dirty region, once the changed
+ *              cells have been redrawn.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Board::clearDirty()
+{
+    dirty = NO_REGION;
 }
 
 
 /********************************************************************
 ** Function: getSpace: Returns a reference to a pointer to Space
- *              object pointed to by specified cell.
+ *              object pointed to by specified cell. Use setSpace or
+ *              apply to change the space, so its type is recorded.
 ** Params:   int x: x-coordinate of space to get.
  *           int y: y-coordinate of space to get.
 ** Returns:  Space *&: reference to pointer to Space object to get.
@@ -163,6 +411,92 @@ Space *&Board::getSpace(int x, int y)
 }
 
 
+/********************************************************************
+** Function: getSpace(overloaded): Returns a pointer to the Space
+ *              object in specified cell of a constant board.
+** Params:   int x: x-coordinate of space to get.
+ *           int y: y-coordinate of space to get.
+** Returns:  Space *: pointer to Space object to get.
+*********************************************************************/
+Space *Board::getSpace(int x, int y) const
+{
+    return board[y][x];
+}
+
+
+/********************************************************************
+** Function: getType: Returns the type of the space in a cell.
+** Params:   int x: x-coordinate of the cell.
+ *           int y: y-coordinate of the cell.
+** Returns:  SpaceType: type of the space, DEFAULTSPACE if the cell
+ *              is empty.
+*********************************************************************/
+SpaceType Board::getType(int x, int y) const
+{
+    return static_cast<SpaceType>(tile_types[y * cols + x]);
+}
+
+
+/********************************************************************
+** Function: isBlocked: Checks if a cell can't be walked on.
+** Params:   int x: x-coordinate of the cell.
+ *           int y: y-coordinate of the cell.
+** Returns:  bool: true if the cell is empty, off the board, or its
+ *              space type can't be crossed, like a chasm.
+*********************************************************************/
+bool Board::isBlocked(int x, int y) const
+{
+    return blockers.isBlocked(x, y);
+}
+
+
+/********************************************************************
+** Function: getBlockers: Returns the cells that can't be walked on,
+ *              kept up to date as spaces are set.
+** Params:   None
+** Returns:  const BlockerMap &: one bit per cell of the board.
+*********************************************************************/
+const BlockerMap &Board::getBlockers() const
+{
+    return blockers;
+}
+
+
+/********************************************************************
+** Function: setFog: Sets the explored set used when printing.
+ *              Unexplored cells are printed as unknown.
+** Params:   const FogOfWar *value: explored set, or nullptr to
+ *              print every cell.
+** Returns:  None
+*********************************************************************/
+void Board::setFog(const FogOfWar *value)
+{
+    fog = value;
+}
+
+
+/********************************************************************
+** Function: setTheme: Sets the theme used to color the icons when
+ *              printing.
+** Params:   const Theme *value: theme to use, or nullptr to print
+ *              plain icons.
+** Returns:  None
+*********************************************************************/
+void Board::setTheme(const Theme *value)
+{
+    theme = value;
+
+    //make room for the longest cells of the new theme
+    const Theme &style = theme ? *theme : Theme::plain();
+    const int ROW_LENGTH = style.getMaxCellLength() * cols + 2;
+
+    if (static_cast<int>(row_buffer.size()) < ROW_LENGTH)
+    {
+        row_buffer.resize(ROW_LENGTH);
+    }
+}
+
+
 /********************************************************************
 ** Function: getRows: Returns number of rows.
 ** Params:   None
@@ -188,76 +522,91 @@ int Board::getCols() const
 /********************************************************************
 ** Function: print: Prints the icons of the space at each cell of
  *              the board.
-** Params:   None
+** Params:   ostream &out: stream to render the board to.
+ *              default = the current IOBackend output.
 ** Returns:  None
 *********************************************************************/
-void Board::print() const
+void Board::print(ostream &out) const
 {
-    //print top border
-    for (int i=0; i<cols; i++)
-    {
-        cout << " _";
-    }
-    cout << endl;
-
-    //print board contents
-    for (int y=0; y<rows; y++)
-    {
-        for (int x=0; x<cols; x++)
-        {
-            //print left cell border
-            cout << "|";
-
-            //print space icon
-            cout << board[y][x]->getIcon();
-        }
-        //print right cell border
-        cout << "|";
-        cout << endl;
-    }
+    //no special character, use coordinates that are never on the board
+    print(-1, -1, '\0', out);
 }
 
 
 /********************************************************************
 ** Function: print(overloaded): Prints the icons of the space at each
  *              cell of the board and prints a special character at
- *              specified coordinates.
+ *              specified coordinates. Each cell's output is copied
+ *              from the theme's lookup table into the row buffer, and
+ *              the row is written to the stream in one call.
 ** Params:   int x: x-coordinate of special character to print.
  *           int y: y-coordinate of special character to print.
  *           char special_character: character icon of special
  *              character to print.
+ *           ostream &out: stream to render the board to.
+ *              default = the current IOBackend output.
 ** Returns:  None
 *********************************************************************/
-void Board::print(int x, int y, char special_character) const
+void Board::print(int x, int y, char special_character, ostream &out) const
 {
+    //print plain icons unless a theme is set
+    const Theme &style = theme ? *theme : Theme::plain();
+
+    //the top border is a space and an underscore per column and a
+    // newline, and every row fits a full cell per column plus the
+    // right border and a newline
+    const int TOP_LENGTH = 2 * cols + 1;
+    const int ROW_LENGTH = style.getMaxCellLength() * cols + 2;
+
+    //only grows the first time a board this wide is printed
+    if (static_cast<int>(row_buffer.size()) < ROW_LENGTH)
+    {
+        row_buffer.resize(ROW_LENGTH);
+    }
+    char *row = &row_buffer[0];
+
     //print top border
     for (int i=0; i<cols; i++)
     {
-        cout << " _";
+        row[2*i] = ' ';
+        row[2*i + 1] = '_';
     }
-    cout << endl;
+    row[2*cols] = '\n';
+    out.write(row, TOP_LENGTH);
 
     //print board contents
     for (int i=0; i<rows; i++)
     {
+        char *cursor = row;
+
         for (int k=0; k<cols; k++)
         {
-            //print left cell border
-            cout << "|";
+            char icon;
 
-            //print space icon, unless the coordinates
+            //space icon, unless the coordinates
             // match the special character coordinates
+            // or the cell hasn't been explored yet
             if (i == y && k == x)
             {
-                cout << special_character;
+                icon = special_character;
+            }
+            else if (fog && !fog->isExplored(k, i))
+            {
+                icon = FogOfWar::UNKNOWN_ICON;
             }
             else
             {
-                cout << board[i][k]->getIcon();
+                icon = board[i][k]->getIcon();
             }
+
+            //left cell border and icon
+            int length = style.getCellLength(icon);
+            std::memcpy(cursor, style.getCell(icon), length);
+            cursor += length;
         }
-        //print right cell border
-        cout << "|";
-        cout << endl;
+        //right cell border
+        *cursor++ = '|';
+        *cursor++ = '\n';
+        out.write(row, cursor - row);
     }
 }
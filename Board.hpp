@@ -11,7 +11,14 @@
  *              a ground tile, a crater tile, a space rock tile, or
  *              a rocket ship tile. Each Space tile will have four
  *              pointers that link it to its adjacent neighboring
- *              tile.
+ *              tile. The type of each cell is also kept in a compact
+ *              array, so it can be read without following pointers,
+ *              and the cells that can't be walked on are kept in a
+ *              BlockerMap, one bit per cell.
+ *              Tiles can be changed while playing by applying a
+ *              TileBatch, which makes every change, links the new
+ *              spaces, and tells the listeners and the dirty region
+ *              once for the whole batch.
 *********************************************************************/
 
 
@@ -19,15 +26,76 @@
 #define BOARD_HPP
 
 #include <iostream>
+#include <string>
+#include <vector>
 #include "Space.hpp"
+#include "SpaceFactory.hpp"
+#include "TileBatch.hpp"
+#include "BlockerMap.hpp"
+#include "BoardListener.hpp"
+#include "FogOfWar.hpp"
+#include "Theme.hpp"
 
 class Board
 {
+public:
+    //a rectangle of cells, empty when right is less than left
+    struct Region
+    {
+        int left;
+        int top;
+        int right;
+        int bottom;
+    };
+
 private:
     int rows;
     int cols;
     Space ***board;
 
+    //SpaceType of each cell, row by row
+    std::vector<unsigned char> tile_types;
+
+    //set for each cell whose space type can't be walked on
+    BlockerMap blockers;
+
+    //told about every batch applied, not owned
+    std::vector<BoardListener*> listeners;
+
+    //cells changed since the last time the dirty region was cleared
+    Region dirty;
+
+    //explored set to hide unexplored cells with, nullptr shows everything
+    const FogOfWar *fog;
+
+    //colors to print the icons with, nullptr prints them plain
+    const Theme *theme;
+
+    //row of output built up before each write, reused between frames
+    mutable std::string row_buffer;
+
+
+    /********************************************************************
+    ** Function: linkCell: Links a space to its adjacent neighboring
+     *              cells, and links them back to it.
+    ** Params:   int x: x-coordinate of the space.
+     *           int y: y-coordinate of the space.
+    ** Returns:  None
+    *********************************************************************/
+    void linkCell(int x, int y);
+
+
+    /********************************************************************
+    ** Function: applyCell: Makes one change of a batch to one cell.
+     *              Replaced spaces are deleted.
+    ** Params:   const TileBatch::Change &change: the change.
+     *           int x: x-coordinate of the cell.
+     *           int y: y-coordinate of the cell.
+     *           bool &relink: set to true if the space was replaced.
+    ** Returns:  bool: true if the cell changed.
+    *********************************************************************/
+    bool applyCell(const TileBatch::Change &change, int x, int y, bool &relink);
+
 public:
 
     /********************************************************************
@@ -62,7 +130,8 @@ public:
 
 
     /********************************************************************
-    ** Function: setSpace: Sets a cell to point to a Space object.
+    ** Function: setSpace: Sets a cell to point to a Space object and
+     *              records its type and if it can be walked on.
     ** Params:   int x: x-coordinate of space to set.
      *           int y: y-coordinate of space to set.
      *           Space *space: pointer to space object to add to cell.
@@ -71,9 +140,60 @@ public:
     void setSpace(int x, int y, Space *space);
 
 
+    /********************************************************************
+    ** Function: apply: Makes every change of a batch, skipping cells
+     *              that are off the board and the ship and worm hole
+     *              cells, which the game links up. Replaced spaces
+     *              are deleted and the new ones are linked to their
+     *              neighbors. Then the dirty region grows to cover the
+     *              changed cells and every listener is told once. Only
+     *              apply batches to a board that owns its spaces, such
+     *              as the game board, not a TiledBoard.
+    ** Params:   const TileBatch &batch: changes to make.
+    ** Returns:  int: number of cells that changed.
+    *********************************************************************/
+    int apply(const TileBatch &batch);
+
+
+    /********************************************************************
+    ** Function: addListener: Adds a listener to tell about batches.
+    ** Params:   BoardListener *listener: listener to add, not owned.
+    ** Returns:  None
+    *********************************************************************/
+    void addListener(BoardListener *listener);
+
+
+    /********************************************************************
+    ** Function: removeListener: Stops telling a listener about batches.
+    ** Params:   BoardListener *listener: listener to remove.
+    ** Returns:  None
+    *********************************************************************/
+    void removeListener(BoardListener *listener);
+
+
+    /********************************************************************
+    ** Function: getDirty: Returns the cells changed by batches since
+     *              the dirty region was last cleared, so a renderer
+     *              only has to redraw those.
+    ** Params:   None
+    ** Returns:  Region: changed cells, empty if none changed.
+    *********************************************************************/
+    Region getDirty() const;
+
+
+    /********************************************************************
+    ** Function: clearDirty: Empties the dirty region, once the changed
+     *              cells have been redrawn.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void clearDirty();
+
+
     /********************************************************************
     ** Function: getSpace: Returns a reference to a pointer to Space
-     *              object pointed to by specified cell.
+     *              object pointed to by specified cell. Use setSpace or
+     *              apply to change the space, so its type is recorded.
     ** Params:   int x: x-coordinate of space to get.
      *           int y: y-coordinate of space to get.
     ** Returns:  Space *&: reference to pointer to Space object to get.
@@ -81,6 +201,65 @@ public:
     Space *&getSpace(int x, int y);
 
 
+    /********************************************************************
+    ** Function: getSpace(overloaded): Returns a pointer to the Space
+     *              object in specified cell of a constant board.
+    ** Params:   int x: x-coordinate of space to get.
+     *           int y: y-coordinate of space to get.
+    ** Returns:  Space *: pointer to Space object to get.
+    *********************************************************************/
+    Space *getSpace(int x, int y) const;
+
+
+    /********************************************************************
+    ** Function: getType: Returns the type of the space in a cell.
+    ** Params:   int x: x-coordinate of the cell.
+     *           int y: y-coordinate of the cell.
+    ** Returns:  SpaceType: type of the space, DEFAULTSPACE if the cell
+     *              is empty.
+    *********************************************************************/
+    SpaceType getType(int x, int y) const;
+
+
+    /********************************************************************
+    ** Function: isBlocked: Checks if a cell can't be walked on.
+    ** Params:   int x: x-coordinate of the cell.
+     *           int y: y-coordinate of the cell.
+    ** Returns:  bool: true if the cell is empty, off the board, or its
+     *              space type can't be crossed, like a chasm.
+    *********************************************************************/
+    bool isBlocked(int x, int y) const;
+
+
+    /********************************************************************
+    ** Function: getBlockers: Returns the cells that can't be walked on,
+     *              kept up to date as spaces are set.
+    ** Params:   None
+    ** Returns:  const BlockerMap &: one bit per cell of the board.
+    *********************************************************************/
+    const BlockerMap &getBlockers() const;
+
+
+    /********************************************************************
+    ** Function: setFog: Sets the explored set used when printing.
+     *              Unexplored cells are printed as unknown.
+    ** Params:   const FogOfWar *value: explored set, or nullptr to
+     *              print every cell.
+    ** Returns:  None
+    *********************************************************************/
+    void setFog(const FogOfWar *value);
+
+
+    /********************************************************************
+    ** Function: setTheme: Sets the theme used to color the icons when
+     *              printing.
+    ** Params:   const Theme *value: theme to use, or nullptr to print
+     *              plain icons.
+    ** Returns:  None
+    *********************************************************************/
+    void setTheme(const Theme *value);
+
+
     /********************************************************************
     ** Function: getRows: Returns number of rows.
     ** Params:   None
@@ -100,10 +279,11 @@ public:
     /********************************************************************
     ** Function: print: Prints the icons of the space at each cell of
      *              the board.
-    ** Params:   None
+    ** Params:   ostream &out: stream to render the board to.
+     *              default = the current IOBackend output.
     ** Returns:  None
     *********************************************************************/
-    void print() const;
+    void print(std::ostream &out = IOBackend::out()) const;
 
 
     /********************************************************************
@@ -114,9 +294,12 @@ public:
      *           int y: y-coordinate of special character to print.
      *           char special_character: character icon of special
      *              character to print.
+     *           ostream &out: stream to render the board to.
+     *              default = the current IOBackend output.
     ** Returns:  None
     *********************************************************************/
-    void print(int x, int y, char special_character) const;
+    void print(int x, int y, char special_character,
+            std::ostream &out = IOBackend::out()) const;
 
 };
 
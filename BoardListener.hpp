@@ -0,0 +1,48 @@
+/*********************************************************************
+** Program name: BoardListener.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 23, 2019 at 10:05 AM
+** Description: Class specification file for BoardListener.
+ *              BoardListener is an abstract base class for anything
+ *              that keeps data worked out from the board's tiles,
+ *              such as distances or a rendered map, and has to
+ *              update it when tiles change. A listener added to a
+ *              board is told once for every batch of changes, with
+ *              the rectangle of cells that changed.
+*********************************************************************/
+
+
+#ifndef BOARD_LISTENER_HPP
+#define BOARD_LISTENER_HPP
+
+class Board;
+
+class BoardListener
+{
+public:
+
+    /********************************************************************
+    ** Function: Destructor: Virtual so derived listeners are destroyed
+     *              properly.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    virtual ~BoardListener() {}
+
+
+    /********************************************************************
+    ** Function: tilesChanged: Pure virtual function called after a
+     *              batch of changes was applied to the board.
+    ** Params:   const Board &board: the board that changed.
+     *           int left: x-coordinate of the first changed column.
+     *           int top: y-coordinate of the first changed row.
+     *           int right: x-coordinate of the last changed column.
+     *           int bottom: y-coordinate of the last changed row.
+    ** Returns:  None
+    *********************************************************************/
+    virtual void tilesChanged(const Board &board, int left, int top,
+                              int right, int bottom) = 0;
+
+};
+
+#endif
@@ -0,0 +1,51 @@
+/*********************************************************************
+** Program name: Chasm.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 27, 2019 at 11:15 AM
+** Description: Class implementation file for Chasm. Chasm is derived
+ *              from Space class. It represents a deep crack in the
+ *              surface of the asteroid that is too wide to jump
+ *              across. Nothing can step onto a chasm, so trying to
+ *              walk into one returns the chasm's description.
+*********************************************************************/
+
+
+#include "Chasm.hpp"
+
+using std::string;
+
+/********************************************************************
+** Function: Constructor/default: Sets coordinates, type, description
+ *              and icon.
+** Params:   int x: x-coordinate of this space.
+ *              default = 0.
+ *           int y: y-coordinate of this space.
+ *              default = 0.
+ *           SpaceType type: type of this space.
+ *              default = CHASM.
+ *           string description: description of this space.
+ *              default = see module header description.
+ *           char icon: icon to visually represent this space.
+ *              default = '%'.
+** Returns:  None
+*********************************************************************/
+Chasm::Chasm(int x, int y, SpaceType type,
+        string description, char icon)
+        : Space(x, y, type, description, icon)
+{}
+
+
+/********************************************************************
+** Function: interact: Prints description of the chasm by calling
+ *              getDesc.
+** Params:   Human * traveler: Pointer to human object in which to
+ *              interact with this space. The human can't get into
+ *              the chasm.
+ *              default = nullptr.
+** Returns:  bool: true ends the game.
+*********************************************************************/
+bool Chasm::interact(Human *traveler)
+{
+    menu.formatPrompt(getDesc());
+    return false;
+}
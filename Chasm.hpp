@@ -0,0 +1,59 @@
+/*********************************************************************
+** Program name: Chasm.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 27, 2019 at 11:15 AM
+** Description: Class specification file for Chasm. Chasm is derived
+ *              from Space class. It represents a deep crack in the
+ *              surface of the asteroid that is too wide to jump
+ *              across. Nothing can step onto a chasm, so trying to
+ *              walk into one returns the chasm's description.
+*********************************************************************/
+
+
+#ifndef CHASM_HPP
+#define CHASM_HPP
+
+#include <iostream>
+#include <string>
+#include "Space.hpp"
+
+class Chasm : public Space
+{
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Sets coordinates, type, description
+     *              and icon.
+    ** Params:   int x: x-coordinate of this space.
+     *              default = 0.
+     *           int y: y-coordinate of this space.
+     *              default = 0.
+     *           SpaceType type: type of this space.
+     *              default = CHASM.
+     *           string description: description of this space.
+     *              default = see module header description.
+     *           char icon: icon to visually represent this space.
+     *              default = '%'.
+    ** Returns:  None
+    *********************************************************************/
+    Chasm(int x = SPACE_CONFIG_LT[CHASM].x_default,
+            int y = SPACE_CONFIG_LT[CHASM].y_default,
+            SpaceType type = SPACE_CONFIG_LT[CHASM].type_default,
+            std::string description = SPACE_CONFIG_LT[CHASM].description_default,
+            char icon = SPACE_CONFIG_LT[CHASM].icon_default);
+
+
+    /********************************************************************
+    ** Function: interact: Prints description of the chasm by calling
+     *              getDesc.
+    ** Params:   Human * traveler: Pointer to human object in which to
+     *              interact with this space. The human can't get into
+     *              the chasm.
+     *              default = nullptr.
+    ** Returns:  bool: true ends the game.
+    *********************************************************************/
+    virtual bool interact(Human *traveler = nullptr) override;
+
+};
+
+#endif
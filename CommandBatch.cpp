@@ -0,0 +1,250 @@
+/*********************************************************************
+** Program name: CommandBatch.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 19, 2019 at 11:10 AM
+** Description: Class implementation file for CommandBatch.
+ *              CommandBatch holds the steps of a compound command
+ *              typed at the move prompt, such as "5R 3U C" or
+ *              "goto 7,2", so the game can run them as one turn.
+ *              Each step is a command and how many times to repeat
+ *              it, or the coordinates to walk to for goto. Steps are
+ *              kept in a fixed array, so parsing a command does not
+ *              allocate.
+*********************************************************************/
+
+
+#include <cctype>
+#include "CommandBatch.hpp"
+
+using std::string;
+using std::size_t;
+
+//initialize static batch constants
+const int CommandBatch::MAX_COUNT = 999;
+
+//word that starts a goto step
+static const char GOTO_WORD[] = "goto";
+static const size_t GOTO_LENGTH = 4;
+
+/********************************************************************
+** Function: skipSpaces: Moves past any whitespace in the text.
+** Params:   const string &text: text being parsed.
+ *           size_t &cursor: position in the text, moved forward.
+** Returns:  None
+*********************************************************************/
+static void skipSpaces(const string &text, size_t &cursor)
+{
+    while (cursor < text.length() && std::isspace(static_cast<unsigned char>(text[cursor])))
+    {
+        cursor++;
+    }
+}
+
+
+/********************************************************************
+** Function: readNumber: Reads a run of digits from the text.
+** Params:   const string &text: text being parsed.
+ *           size_t &cursor: position in the text, moved past the
+ *              digits.
+ *           int &value: set to the number read.
+** Returns:  bool: false if there were no digits or the number is
+ *              larger than MAX_COUNT.
+*********************************************************************/
+static bool readNumber(const string &text, size_t &cursor, int &value)
+{
+    size_t start = cursor;
+    value = 0;
+
+    while (cursor < text.length() && std::isdigit(static_cast<unsigned char>(text[cursor])))
+    {
+        value = value * 10 + (text[cursor] - '0');
+        cursor++;
+
+        if (value > CommandBatch::MAX_COUNT)
+        {
+            return false;
+        }
+    }
+
+    return cursor > start;
+}
+
+
+/********************************************************************
+** Function: Constructor/default: Creates an empty batch.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+CommandBatch::CommandBatch() : step_count(0)
+{}
+
+
+/********************************************************************
+** Function: add: Adds a step to the end of the batch.
+** Params:   Command command: command to run.
+ *           int count: how many times to run it.
+ *           int x: x-coordinate for goto, 0 otherwise.
+ *           int y: y-coordinate for goto, 0 otherwise.
+** Returns:  bool: false if the batch is already full.
+*********************************************************************/
+bool CommandBatch::add(Command command, int count, int x, int y)
+{
+    if (step_count == MAX_STEPS)
+    {
+        return false;
+    }
+
+    Step &step = steps[step_count++];
+    step.command = command;
+    step.count = count;
+    step.x = x;
+    step.y = y;
+    return true;
+}
+
+
+/********************************************************************
+** Function: parse: Replaces the batch with the steps in a command
+ *              line. Steps are an optional count followed by U, R,
+ *              D, L, C, or I, or "goto x,y". Letters can be upper
+ *              or lower case, and spaces between steps are
+ *              optional. Leaves the batch empty if the line is not
+ *              a valid command.
+** Params:   const std::string &text: the command line.
+** Returns:  bool: true if the whole line was valid.
+*********************************************************************/
+bool CommandBatch::parse(const string &text)
+{
+    size_t cursor = 0;
+    bool valid = true;
+
+    clear();
+    skipSpaces(text, cursor);
+
+    while (valid && cursor < text.length())
+    {
+        //check for goto, in any case
+        size_t matched = 0;
+        while (matched < GOTO_LENGTH && cursor + matched < text.length()
+               && std::tolower(static_cast<unsigned char>(text[cursor + matched]))
+                  == GOTO_WORD[matched])
+        {
+            matched++;
+        }
+
+        if (matched == GOTO_LENGTH)
+        {
+            //read the coordinates, separated by a comma or spaces
+            int x = 0;
+            int y = 0;
+            cursor += matched;
+            skipSpaces(text, cursor);
+            valid = readNumber(text, cursor, x);
+
+            skipSpaces(text, cursor);
+            if (cursor < text.length() && text[cursor] == ',')
+            {
+                cursor++;
+                skipSpaces(text, cursor);
+            }
+            valid = valid && readNumber(text, cursor, y) && add(GOTO, 1, x, y);
+        }
+        else
+        {
+            //read the optional count, 1 if there isn't one
+            int count = 1;
+            if (std::isdigit(static_cast<unsigned char>(text[cursor])))
+            {
+                valid = readNumber(text, cursor, count) && count > 0;
+            }
+
+            //read the command letter
+            Command command = CHECK_SPACE;
+            char letter = (cursor < text.length())
+                    ? std::toupper(static_cast<unsigned char>(text[cursor])) : '\0';
+            cursor++;
+
+            switch (letter)
+            {
+                case 'U' :
+                    command = MOVE_UP;
+                    break;
+                case 'R' :
+                    command = MOVE_RIGHT;
+                    break;
+                case 'D' :
+                    command = MOVE_DOWN;
+                    break;
+                case 'L' :
+                    command = MOVE_LEFT;
+                    break;
+                case 'C' :
+                    command = CHECK_SPACE;
+                    break;
+                case 'I' :
+                    command = CHECK_INVENTORY;
+                    break;
+                default :
+                    valid = false;
+                    break;
+            }
+
+            valid = valid && add(command, count);
+        }
+
+        skipSpaces(text, cursor);
+    }
+
+    //an empty line is not a command
+    if (!valid || step_count == 0)
+    {
+        clear();
+        return false;
+    }
+    return true;
+}
+
+
+/********************************************************************
+** Function: setSingle: Replaces the batch with a single command.
+** Params:   Command command: command to run once.
+** Returns:  None
+*********************************************************************/
+void CommandBatch::setSingle(Command command)
+{
+    clear();
+    add(command, 1);
+}
+
+
+/********************************************************************
+** Function: clear: Removes every step.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void CommandBatch::clear()
+{
+    step_count = 0;
+}
+
+
+/********************************************************************
+** Function: size: Returns the number of steps.
+** Params:   None
+** Returns:  int: number of steps in the batch.
+*********************************************************************/
+int CommandBatch::size() const
+{
+    return step_count;
+}
+
+
+/********************************************************************
+** Function: getStep: Returns a step of the batch.
+** Params:   int index: 0-based index of the step.
+** Returns:  const Step &: the step.
+*********************************************************************/
+const CommandBatch::Step &CommandBatch::getStep(int index) const
+{
+    return steps[index];
+}
@@ -0,0 +1,122 @@
+/*********************************************************************
+** Program name: CommandBatch.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 19, 2019 at 11:10 AM
+** Description: Class specification file for CommandBatch.
+ *              CommandBatch holds the steps of a compound command
+ *              typed at the move prompt, such as "5R 3U C" or
+ *              "goto 7,2", so the game can run them as one turn.
+ *              Each step is a command and how many times to repeat
+ *              it, or the coordinates to walk to for goto. Steps are
+ *              kept in a fixed array, so parsing a command does not
+ *              allocate.
+*********************************************************************/
+
+
+#ifndef COMMAND_BATCH_HPP
+#define COMMAND_BATCH_HPP
+
+#include <string>
+
+class CommandBatch
+{
+public:
+    //commands, numbered like the game's action menu
+    enum Command
+    {
+        MOVE_UP = 1,
+        MOVE_RIGHT,
+        MOVE_DOWN,
+        MOVE_LEFT,
+        CHECK_SPACE,
+        CHECK_INVENTORY,
+        GOTO
+    };
+
+    //one command, repeated count times, or the target of a goto
+    struct Step
+    {
+        Command command;
+        int count;
+        int x;
+        int y;
+    };
+
+    //most steps in one command line
+    enum {MAX_STEPS = 32};
+
+    //largest repeat count for one step
+    static const int MAX_COUNT;
+
+private:
+    Step steps[MAX_STEPS];
+    int step_count;
+
+
+    /********************************************************************
+    ** Function: add: Adds a step to the end of the batch.
+    ** Params:   Command command: command to run.
+     *           int count: how many times to run it.
+     *           int x: x-coordinate for goto, 0 otherwise.
+     *           int y: y-coordinate for goto, 0 otherwise.
+    ** Returns:  bool: false if the batch is already full.
+    *********************************************************************/
+    bool add(Command command, int count, int x = 0, int y = 0);
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Creates an empty batch.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    CommandBatch();
+
+
+    /********************************************************************
+    ** Function: parse: Replaces the batch with the steps in a command
+     *              line. Steps are an optional count followed by U, R,
+     *              D, L, C, or I, or "goto x,y". Letters can be upper
+     *              or lower case, and spaces between steps are
+     *              optional. Leaves the batch empty if the line is not
+     *              a valid command.
+    ** Params:   const std::string &text: the command line.
+    ** Returns:  bool: true if the whole line was valid.
+    *********************************************************************/
+    bool parse(const std::string &text);
+
+
+    /********************************************************************
+    ** Function: setSingle: Replaces the batch with a single command.
+    ** Params:   Command command: command to run once.
+    ** Returns:  None
+    *********************************************************************/
+    void setSingle(Command command);
+
+
+    /********************************************************************
+    ** Function: clear: Removes every step.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void clear();
+
+
+    /********************************************************************
+    ** Function: size: Returns the number of steps.
+    ** Params:   None
+    ** Returns:  int: number of steps in the batch.
+    *********************************************************************/
+    int size() const;
+
+
+    /********************************************************************
+    ** Function: getStep: Returns a step of the batch.
+    ** Params:   int index: 0-based index of the step.
+    ** Returns:  const Step &: the step.
+    *********************************************************************/
+    const Step &getStep(int index) const;
+
+};
+
+#endif
@@ -0,0 +1,33 @@
+/*********************************************************************
+** Program name: ConsoleIO.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 20, 2019 at 2:45 PM
+** Description: Class implementation file for ConsoleIO. ConsoleIO is
+ *              an IOBackend that reads from cin and prints to cout.
+ *              It is the backend the game uses unless another one is
+ *              set.
+*********************************************************************/
+
+
+#include "ConsoleIO.hpp"
+
+/********************************************************************
+** Function: input: Returns cin.
+** Params:   None
+** Returns:  istream &: standard input.
+*********************************************************************/
+std::istream &ConsoleIO::input()
+{
+    return std::cin;
+}
+
+
+/********************************************************************
+** Function: output: Returns cout.
+** Params:   None
+** Returns:  ostream &: standard output.
+*********************************************************************/
+std::ostream &ConsoleIO::output()
+{
+    return std::cout;
+}
@@ -0,0 +1,38 @@
+/*********************************************************************
+** Program name: ConsoleIO.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 20, 2019 at 2:45 PM
+** Description: Class specification file for ConsoleIO. ConsoleIO is
+ *              an IOBackend that reads from cin and prints to cout.
+ *              It is the backend the game uses unless another one is
+ *              set.
+*********************************************************************/
+
+
+#ifndef CONSOLE_IO_HPP
+#define CONSOLE_IO_HPP
+
+#include "IOBackend.hpp"
+
+class ConsoleIO : public IOBackend
+{
+public:
+
+    /********************************************************************
+    ** Function: input: Returns cin.
+    ** Params:   None
+    ** Returns:  istream &: standard input.
+    *********************************************************************/
+    virtual std::istream &input() override;
+
+
+    /********************************************************************
+    ** Function: output: Returns cout.
+    ** Params:   None
+    ** Returns:  ostream &: standard output.
+    *********************************************************************/
+    virtual std::ostream &output() override;
+
+};
+
+#endif
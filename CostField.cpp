@@ -0,0 +1,236 @@
+/*********************************************************************
+** Program name: CostField.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 25, 2019 at 10:05 AM
+** Description: Class implementation file for CostField. CostField
+ *              holds the oxygen it takes to get from a starting cell
+ *              to every cell of the board, where stepping onto a
+ *              cell costs the oxygen set for its space type. It is
+ *              found with Dijkstra's algorithm on a bucket queue:
+ *              costs are small whole numbers, so the cells waiting
+ *              to be visited are kept in one bucket per amount of
+ *              oxygen, and the next cell is always in the bucket
+ *              being emptied. Buckets are reused in a circle, since
+ *              no cell waiting is further ahead than the largest
+ *              cost. Linked worm holes can be added, they cost no
+ *              oxygen. Like FlowField, the field has a border of
+ *              blocked cells around the board, so looking at a
+ *              neighbor never needs a bounds check.
+*********************************************************************/
+
+
+#include "CostField.hpp"
+#include "Board.hpp"
+
+//initialize distance constants
+const int CostField::UNREACHABLE = -1;
+const int CostField::WALL = 1 << 30;
+
+/********************************************************************
+** Function: Constructor: Creates a field for a board where every
+ *              cell costs 1.
+** Params:   int rows: number of rows of the board.
+ *           int cols: number of columns of the board.
+** Returns:  None
+*********************************************************************/
+CostField::CostField(int rows, int cols) : rows(0), cols(0), stride(0)
+{
+    resize(rows, cols);
+}
+
+
+/********************************************************************
+** Function: cell: Returns the padded index of a board cell.
+** Params:   int x: x-coordinate.
+ *           int y: y-coordinate.
+** Returns:  int: index into costs and distances.
+*********************************************************************/
+int CostField::cell(int x, int y) const
+{
+    return (y + 1) * stride + (x + 1);
+}
+
+
+/********************************************************************
+** Function: resize: Sets the size of the board. Every cell costs 1
+ *              again and the links are removed.
+** Params:   int rows: number of rows of the board.
+ *           int cols: number of columns of the board.
+** Returns:  None
+*********************************************************************/
+void CostField::resize(int rows, int cols)
+{
+    this->rows = rows;
+    this->cols = cols;
+    stride = cols + 2;
+
+    const int PADDED = (rows + 2) * (cols + 2);
+    costs.assign(PADDED, 0);
+    distances.assign(PADDED, WALL);
+    links.clear();
+
+    //open up the board inside the border
+    for (int row=0; row<rows; row++)
+    {
+        for (int col=0; col<cols; col++)
+        {
+            costs[cell(col, row)] = 1;
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: setCost: Sets the oxygen it takes to step onto a cell.
+** Params:   int x: x-coordinate.
+ *           int y: y-coordinate.
+ *           int cost: oxygen cost, 0 or less blocks the cell.
+** Returns:  None
+*********************************************************************/
+void CostField::setCost(int x, int y, int cost)
+{
+    if (cost < 0)
+    {
+        cost = 0;
+    }
+    else if (cost > MAX_COST)
+    {
+        cost = MAX_COST;
+    }
+
+    costs[cell(x, y)] = static_cast<unsigned char>(cost);
+}
+
+
+/********************************************************************
+** Function: setCosts: Sets the cost of every cell from the oxygen
+ *              cost of its space type. Empty cells and chasms
+ *              can't be walked on.
+** Params:   const Board &board: board of the same size.
+** Returns:  None
+*********************************************************************/
+void CostField::setCosts(const Board &board)
+{
+    for (int y=0; y<rows; y++)
+    {
+        for (int x=0; x<cols; x++)
+        {
+            SpaceType type = board.getType(x, y);
+            setCost(x, y, SPACE_CONFIG_LT[type].passable ? SPACE_CONFIG_LT[type].oxygen_cost : 0);
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: setLink: Makes a cell lead to another cell for no
+ *              oxygen, like a linked worm hole.
+** Params:   int x: x-coordinate of the worm hole.
+ *           int y: y-coordinate of the worm hole.
+ *           int to_x: x-coordinate of the other end.
+ *           int to_y: y-coordinate of the other end.
+** Returns:  None
+*********************************************************************/
+void CostField::setLink(int x, int y, int to_x, int to_y)
+{
+    if (links.empty())
+    {
+        links.assign(costs.size(), -1);
+    }
+
+    links[cell(x, y)] = cell(to_x, to_y);
+}
+
+
+/********************************************************************
+** Function: search: Finds the oxygen it takes to get from a cell
+ *              to every other cell.
+** Params:   int x: x-coordinate to start at.
+ *           int y: y-coordinate to start at.
+** Returns:  int: number of cells reached.
+*********************************************************************/
+int CostField::search(int x, int y)
+{
+    const int NEIGHBORS[] = {-stride, 1, stride, -1};
+    const int BUCKETS = MAX_COST + 1;
+
+    distances.assign(distances.size(), WALL);
+    for (int i=0; i<BUCKETS; i++)
+    {
+        buckets[i].clear();
+    }
+
+    int start = cell(x, y);
+    if (!costs[start])
+    {
+        return 0;
+    }
+
+    distances[start] = 0;
+    buckets[0].push_back(start);
+    long waiting = 1;
+    int reached = 0;
+
+    //empty the buckets in order of oxygen. A step costs at least 1
+    // and at most MAX_COST, so it lands in one of the other buckets
+    for (int oxygen=0; waiting > 0; oxygen++)
+    {
+        std::vector<int> &bucket = buckets[oxygen % BUCKETS];
+
+        for (std::size_t i=0; i<bucket.size(); i++)
+        {
+            int here = bucket[i];
+
+            //it was reached for less oxygen after it was queued
+            if (distances[here] != oxygen)
+            {
+                continue;
+            }
+            reached++;
+
+            //a worm hole adds its other end to this bucket
+            if (!links.empty())
+            {
+                int target = links[here];
+                if (target >= 0 && costs[target] && distances[target] > oxygen)
+                {
+                    distances[target] = oxygen;
+                    bucket.push_back(target);
+                    waiting++;
+                }
+            }
+
+            for (int k=0; k<4; k++)
+            {
+                int neighbor = here + NEIGHBORS[k];
+                int total = oxygen + costs[neighbor];
+
+                if (costs[neighbor] && total < distances[neighbor])
+                {
+                    distances[neighbor] = total;
+                    buckets[total % BUCKETS].push_back(neighbor);
+                    waiting++;
+                }
+            }
+        }
+
+        waiting -= bucket.size();
+        bucket.clear();
+    }
+
+    return reached;
+}
+
+
+/********************************************************************
+** Function: distance: Returns the oxygen it takes to get to a cell
+ *              from the start of the last search.
+** Params:   int x: x-coordinate.
+ *           int y: y-coordinate.
+** Returns:  int: oxygen, or UNREACHABLE.
+*********************************************************************/
+int CostField::distance(int x, int y) const
+{
+    int oxygen = distances[cell(x, y)];
+    return (oxygen == WALL) ? UNREACHABLE : oxygen;
+}
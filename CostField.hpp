@@ -0,0 +1,143 @@
+/*********************************************************************
+** Program name: CostField.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 25, 2019 at 10:05 AM
+** Description: Class specification file for CostField. CostField
+ *              holds the oxygen it takes to get from a starting cell
+ *              to every cell of the board, where stepping onto a
+ *              cell costs the oxygen set for its space type. It is
+ *              found with Dijkstra's algorithm on a bucket queue:
+ *              costs are small whole numbers, so the cells waiting
+ *              to be visited are kept in one bucket per amount of
+ *              oxygen, and the next cell is always in the bucket
+ *              being emptied. Buckets are reused in a circle, since
+ *              no cell waiting is further ahead than the largest
+ *              cost. Linked worm holes can be added, they cost no
+ *              oxygen. Like FlowField, the field has a border of
+ *              blocked cells around the board, so looking at a
+ *              neighbor never needs a bounds check.
+*********************************************************************/
+
+
+#ifndef COST_FIELD_HPP
+#define COST_FIELD_HPP
+
+#include <vector>
+
+class Board;
+
+class CostField
+{
+public:
+    //oxygen reported for cells that can't be reached
+    static const int UNREACHABLE;
+
+    //largest oxygen cost of a cell, larger costs are lowered to it
+    enum {MAX_COST = 15};
+
+private:
+    //stored oxygen of cells that haven't been reached
+    static const int WALL;
+
+    int rows;
+    int cols;
+    int stride;
+
+    //oxygen to step onto each padded cell, 0 for blocked cells
+    std::vector<unsigned char> costs;
+
+    //oxygen from the start to each padded cell
+    std::vector<int> distances;
+
+    //padded cell each cell's worm hole leads to, -1 for none. Left
+    // empty until a link is added
+    std::vector<int> links;
+
+    //cells waiting to be visited, by oxygen modulo MAX_COST + 1
+    std::vector<int> buckets[MAX_COST + 1];
+
+
+    /********************************************************************
+    ** Function: cell: Returns the padded index of a board cell.
+    ** Params:   int x: x-coordinate.
+     *           int y: y-coordinate.
+    ** Returns:  int: index into costs and distances.
+    *********************************************************************/
+    int cell(int x, int y) const;
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor: Creates a field for a board where every
+     *              cell costs 1.
+    ** Params:   int rows: number of rows of the board.
+     *           int cols: number of columns of the board.
+    ** Returns:  None
+    *********************************************************************/
+    CostField(int rows, int cols);
+
+
+    /********************************************************************
+    ** Function: resize: Sets the size of the board. Every cell costs 1
+     *              again and the links are removed.
+    ** Params:   int rows: number of rows of the board.
+     *           int cols: number of columns of the board.
+    ** Returns:  None
+    *********************************************************************/
+    void resize(int rows, int cols);
+
+
+    /********************************************************************
+    ** Function: setCost: Sets the oxygen it takes to step onto a cell.
+    ** Params:   int x: x-coordinate.
+     *           int y: y-coordinate.
+     *           int cost: oxygen cost, 0 or less blocks the cell.
+    ** Returns:  None
+    *********************************************************************/
+    void setCost(int x, int y, int cost);
+
+
+    /********************************************************************
+    ** Function: setCosts: Sets the cost of every cell from the oxygen
+     *              cost of its space type. Empty cells and chasms
+     *              can't be walked on.
+    ** Params:   const Board &board: board of the same size.
+    ** Returns:  None
+    *********************************************************************/
+    void setCosts(const Board &board);
+
+
+    /********************************************************************
+    ** Function: setLink: Makes a cell lead to another cell for no
+     *              oxygen, like a linked worm hole.
+    ** Params:   int x: x-coordinate of the worm hole.
+     *           int y: y-coordinate of the worm hole.
+     *           int to_x: x-coordinate of the other end.
+     *           int to_y: y-coordinate of the other end.
+    ** Returns:  None
+    *********************************************************************/
+    void setLink(int x, int y, int to_x, int to_y);
+
+
+    /********************************************************************
+    ** Function: search: Finds the oxygen it takes to get from a cell
+     *              to every other cell.
+    ** Params:   int x: x-coordinate to start at.
+     *           int y: y-coordinate to start at.
+    ** Returns:  int: number of cells reached.
+    *********************************************************************/
+    int search(int x, int y);
+
+
+    /********************************************************************
+    ** Function: distance: Returns the oxygen it takes to get to a cell
+     *              from the start of the last search.
+    ** Params:   int x: x-coordinate.
+     *           int y: y-coordinate.
+    ** Returns:  int: oxygen, or UNREACHABLE.
+    *********************************************************************/
+    int distance(int x, int y) const;
+
+};
+
+#endif
@@ -14,10 +14,12 @@
 
 #include "Crater.hpp"
 
-using std::cout;
 using std::endl;
 using std::string;
 
+//initialize static prompt
+const string Crater::JUMP_PROMPT = "Do you want to jump in the crater?";
+
 /********************************************************************
 ** Function: Constructor/default: Sets coordinates, type, description
  *              and icon. Sets treasure, has alien, and alien name to
@@ -59,17 +61,14 @@ bool Crater::interact(Human *traveler)
         menu.formatPrompt(getDesc());
 
         //ask user if they want to jump in
-        const string CRATER_PROMPT =
-                "Do you want to jump in the crater?";
-
-        if (menu.confirm(CRATER_PROMPT) == Menu::YES)
+        if (menu.confirm(JUMP_PROMPT) == Menu::YES)
         {
             //print border
             menu.printBorder();
-            cout << endl;
+            IOBackend::out() << endl;
 
             //print that you jumped in
-            cout << "You jumped into the crater..." << endl;
+            IOBackend::out() << "You jumped into the crater..." << endl;
 
             //call parent AsteroidObject interact
             // to check for aliens or items
@@ -22,6 +22,10 @@
 
 class Crater : public AsteroidObject
 {
+private:
+    //prompt asking if you want to search this space
+    static const std::string JUMP_PROMPT;
+
 public:
 
     /********************************************************************
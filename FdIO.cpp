@@ -0,0 +1,165 @@
+/*********************************************************************
+** Program name: FdIO.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 20, 2019 at 2:45 PM
+** Description: Class implementation file for FdIO. FdIO is an
+ *              IOBackend that reads from and writes to file
+ *              descriptors, such as pipes or a connected socket, so
+ *              the game can be played by another program or over the
+ *              network. Input and output are buffered, and output is
+ *              sent whenever the stream is flushed. The descriptors
+ *              are not closed by FdIO.
+*********************************************************************/
+
+
+#include <cerrno>
+#include <unistd.h>
+#include "FdIO.hpp"
+
+/********************************************************************
+** Function: Buffer::Buffer: Sets up empty read and write areas.
+** Params:   int in_fd: descriptor to read from.
+ *           int out_fd: descriptor to write to.
+** Returns:  None
+*********************************************************************/
+FdIO::Buffer::Buffer(int in_fd, int out_fd) : in_fd(in_fd), out_fd(out_fd)
+{
+    setg(in_buffer, in_buffer, in_buffer);
+    setp(out_buffer, out_buffer + BUFFER_SIZE);
+}
+
+
+/********************************************************************
+** Function: Buffer::flushOutput: Writes everything in the write
+ *              area, retrying partial and interrupted writes.
+** Params:   None
+** Returns:  bool: false if the descriptor could not be written.
+*********************************************************************/
+bool FdIO::Buffer::flushOutput()
+{
+    const char *cursor = pbase();
+
+    while (cursor < pptr())
+    {
+        ssize_t written = write(out_fd, cursor, pptr() - cursor);
+        if (written == -1 && errno == EINTR)
+        {
+            continue;
+        }
+        if (written <= 0)
+        {
+            return false;
+        }
+        cursor += written;
+    }
+
+    setp(out_buffer, out_buffer + BUFFER_SIZE);
+    return true;
+}
+
+
+/********************************************************************
+** Function: Buffer::underflow: Reads more input once the read area
+ *              has been used up.
+** Params:   None
+** Returns:  int_type: the next character, or eof if the descriptor
+ *              was closed.
+*********************************************************************/
+FdIO::Buffer::int_type FdIO::Buffer::underflow()
+{
+    //send any output first, the other end may be waiting on it
+    flushOutput();
+
+    ssize_t count = 0;
+    do
+    {
+        count = read(in_fd, in_buffer, BUFFER_SIZE);
+    } while (count == -1 && errno == EINTR);
+
+    if (count <= 0)
+    {
+        return traits_type::eof();
+    }
+
+    setg(in_buffer, in_buffer, in_buffer + count);
+    return traits_type::to_int_type(in_buffer[0]);
+}
+
+
+/********************************************************************
+** Function: Buffer::overflow: Sends the full write area and stores
+ *              the character that didn't fit.
+** Params:   int_type c: character to write.
+** Returns:  int_type: the character written, or eof on failure.
+*********************************************************************/
+FdIO::Buffer::int_type FdIO::Buffer::overflow(int_type c)
+{
+    if (!flushOutput())
+    {
+        return traits_type::eof();
+    }
+
+    if (!traits_type::eq_int_type(c, traits_type::eof()))
+    {
+        *pptr() = traits_type::to_char_type(c);
+        pbump(1);
+    }
+    return traits_type::not_eof(c);
+}
+
+
+/********************************************************************
+** Function: Buffer::sync: Sends the write area when the stream is
+ *              flushed.
+** Params:   None
+** Returns:  int: 0 on success, -1 on failure.
+*********************************************************************/
+int FdIO::Buffer::sync()
+{
+    return flushOutput() ? 0 : -1;
+}
+
+
+/********************************************************************
+** Function: Constructor: Creates a backend for file descriptors.
+** Params:   int in_fd: descriptor to read input from.
+ *           int out_fd: descriptor to write output to, the same as
+ *              in_fd for a socket.
+** Returns:  None
+*********************************************************************/
+FdIO::FdIO(int in_fd, int out_fd) : buffer(in_fd, out_fd),
+        source(&buffer), sink(&buffer)
+{}
+
+
+/********************************************************************
+** Function: Destructor: Sends any output still in the buffer.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+FdIO::~FdIO()
+{
+    sink.flush();
+}
+
+
+/********************************************************************
+** Function: input: Returns the stream reading in_fd.
+** Params:   None
+** Returns:  istream &: input stream.
+*********************************************************************/
+std::istream &FdIO::input()
+{
+    return source;
+}
+
+
+/********************************************************************
+** Function: output: Returns the stream writing out_fd.
+** Params:   None
+** Returns:  ostream &: output stream.
+*********************************************************************/
+std::ostream &FdIO::output()
+{
+    return sink;
+}
@@ -0,0 +1,87 @@
+/*********************************************************************
+** Program name: FdIO.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 20, 2019 at 2:45 PM
+** Description: Class specification file for FdIO. FdIO is an
+ *              IOBackend that reads from and writes to file
+ *              descriptors, such as pipes or a connected socket, so
+ *              the game can be played by another program or over the
+ *              network. Input and output are buffered, and output is
+ *              sent whenever the stream is flushed. The descriptors
+ *              are not closed by FdIO.
+*********************************************************************/
+
+
+#ifndef FD_IO_HPP
+#define FD_IO_HPP
+
+#include <streambuf>
+#include "IOBackend.hpp"
+
+class FdIO : public IOBackend
+{
+private:
+    //stream buffer that reads and writes a pair of file descriptors
+    class Buffer : public std::streambuf
+    {
+    private:
+        enum {BUFFER_SIZE = 4096};
+
+        int in_fd;
+        int out_fd;
+        char in_buffer[BUFFER_SIZE];
+        char out_buffer[BUFFER_SIZE];
+
+        bool flushOutput();
+
+    protected:
+        virtual int_type underflow() override;
+        virtual int_type overflow(int_type c) override;
+        virtual int sync() override;
+
+    public:
+        Buffer(int in_fd, int out_fd);
+    };
+
+    Buffer buffer;
+    std::istream source;
+    std::ostream sink;
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor: Creates a backend for file descriptors.
+    ** Params:   int in_fd: descriptor to read input from.
+     *           int out_fd: descriptor to write output to, the same as
+     *              in_fd for a socket.
+    ** Returns:  None
+    *********************************************************************/
+    FdIO(int in_fd, int out_fd);
+
+
+    /********************************************************************
+    ** Function: Destructor: Sends any output still in the buffer.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    virtual ~FdIO();
+
+
+    /********************************************************************
+    ** Function: input: Returns the stream reading in_fd.
+    ** Params:   None
+    ** Returns:  istream &: input stream.
+    *********************************************************************/
+    virtual std::istream &input() override;
+
+
+    /********************************************************************
+    ** Function: output: Returns the stream writing out_fd.
+    ** Params:   None
+    ** Returns:  ostream &: output stream.
+    *********************************************************************/
+    virtual std::ostream &output() override;
+
+};
+
+#endif
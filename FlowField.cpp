@@ -0,0 +1,286 @@
+/*********************************************************************
+** Program name: FlowField.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 22, 2019 at 11:15 AM
+** Description: Class implementation file for FlowField. FlowField
+ *              holds the walking distance from every cell of the
+ *              board to a target, found with a breadth-first search.
+ *              Anything chasing the target only has to step to the
+ *              neighbor with the smallest distance, so one field is
+ *              shared by every chaser and its cost depends on the
+ *              size of the board, not on how many are chasing.
+ *              When the target moves to a neighboring cell the field
+ *              is updated instead of searched again. Every move on a
+ *              grid changes the distance of each cell by exactly one,
+ *              so only the cells that get closer are visited and all
+ *              the others get one further away through a shared bias.
+ *              The field has a border of blocked cells around the
+ *              board, so looking at a neighbor never needs a bounds
+ *              check. It listens to the board and takes the blocked
+ *              cells again after every batch of tile changes.
+*********************************************************************/
+
+
+#include <cstdlib>
+#include "FlowField.hpp"
+#include "Board.hpp"
+
+//initialize distance constants
+const int FlowField::UNREACHABLE = -1;
+const int FlowField::WALL = 1 << 30;
+const int FlowField::MAX_BIAS = 1 << 20;
+
+/********************************************************************
+** Function: Constructor: Creates a field for a board with nothing
+ *              blocked and the target at (x, y).
+** Params:   int rows: number of rows of the board.
+ *           int cols: number of columns of the board.
+ *           int x: x-coordinate of the target.
+ *           int y: y-coordinate of the target.
+** Returns:  None
+*********************************************************************/
+FlowField::FlowField(int rows, int cols, int x, int y)
+        : rows(rows), cols(cols), stride(cols + 2), target(0), bias(0),
+          distances((rows + 2) * (cols + 2), WALL),
+          blocked((rows + 2) * (cols + 2), 1)
+{
+    queue.reserve(rows * cols);
+
+    //open up the board inside the border
+    for (int row=0; row<rows; row++)
+    {
+        for (int col=0; col<cols; col++)
+        {
+            blocked[cell(col, row)] = 0;
+        }
+    }
+
+    target = cell(x, y);
+    rebuild();
+}
+
+
+/********************************************************************
+** Function: cell: Returns the padded index of a board cell.
+** Params:   int x: x-coordinate.
+ *           int y: y-coordinate.
+** Returns:  int: index into distances and blocked.
+*********************************************************************/
+int FlowField::cell(int x, int y) const
+{
+    return (y + 1) * stride + (x + 1);
+}
+
+
+/********************************************************************
+** Function: rebuild: Searches the whole board again from the
+ *              target and resets the bias.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void FlowField::rebuild()
+{
+    const int NEIGHBORS[] = {-stride, 1, stride, -1};
+
+    distances.assign(distances.size(), WALL);
+    bias = 0;
+
+    queue.clear();
+    distances[target] = 0;
+    queue.push_back(target);
+
+    //breadth-first search, every cell is queued at most once
+    for (std::size_t head=0; head<queue.size(); head++)
+    {
+        int current = queue[head];
+        int next_distance = distances[current] + 1;
+
+        for (int i=0; i<4; i++)
+        {
+            int neighbor = current + NEIGHBORS[i];
+            if (!blocked[neighbor] && distances[neighbor] == WALL)
+            {
+                distances[neighbor] = next_distance;
+                queue.push_back(neighbor);
+            }
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: shift: Updates the field for a target that moved to a
+ *              neighboring cell. Starting at the new target, only
+ *              cells whose old distance grows by one along the way
+ *              are visited, those are the cells that get one step
+ *              closer. The rest get one step further away by
+ *              raising the bias.
+** Params:   int next: padded index of the new target.
+** Returns:  None
+*********************************************************************/
+void FlowField::shift(int next)
+{
+    const int NEIGHBORS[] = {-stride, 1, stride, -1};
+
+    //cells that get closer drop by 2, since the bias adds 1 to all
+    queue.clear();
+    distances[next] -= 2;
+    queue.push_back(next);
+
+    for (std::size_t head=0; head<queue.size(); head++)
+    {
+        int current = queue[head];
+
+        //old distance of the current cell, plus one
+        int further = distances[current] + 2 + bias + 1;
+
+        for (int i=0; i<4; i++)
+        {
+            //blocked and unreachable cells are far larger than any
+            // distance, and cells already visited have dropped, so
+            // neither can match
+            int neighbor = current + NEIGHBORS[i];
+            if (distances[neighbor] + bias == further)
+            {
+                distances[neighbor] -= 2;
+                queue.push_back(neighbor);
+            }
+        }
+    }
+
+    bias++;
+    target = next;
+
+    //start the bias over before it could overflow
+    if (bias > MAX_BIAS)
+    {
+        rebuild();
+    }
+}
+
+
+/********************************************************************
+** Function: setBlocked: Marks a cell as one that can't be walked
+ *              through, and searches again.
+** Params:   int x: x-coordinate.
+ *           int y: y-coordinate.
+ *           bool is_blocked: true to block the cell.
+** Returns:  None
+*********************************************************************/
+void FlowField::setBlocked(int x, int y, bool is_blocked)
+{
+    blocked[cell(x, y)] = is_blocked;
+    rebuild();
+}
+
+
+/********************************************************************
+** Function: tilesChanged: Takes the blocked cells of the changed
+ *              tiles from the board and searches again.
+** Params:   const Board &board: the board that changed.
+ *           int left: x-coordinate of the first changed column.
+ *           int top: y-coordinate of the first changed row.
+ *           int right: x-coordinate of the last changed column.
+ *           int bottom: y-coordinate of the last changed row.
+** Returns:  None
+*********************************************************************/
+void FlowField::tilesChanged(const Board &board, int left, int top,
+                             int right, int bottom)
+{
+    for (int y=top; y<=bottom; y++)
+    {
+        for (int x=left; x<=right; x++)
+        {
+            blocked[cell(x, y)] = board.isBlocked(x, y);
+        }
+    }
+
+    //one search for the whole batch
+    rebuild();
+}
+
+
+/********************************************************************
+** Function: moveTarget: Moves the target. A move to a neighboring
+ *              cell updates the field, any other move, such as
+ *              through a worm hole, searches again.
+** Params:   int x: new x-coordinate of the target.
+ *           int y: new y-coordinate of the target.
+** Returns:  None
+*********************************************************************/
+void FlowField::moveTarget(int x, int y)
+{
+    int next = cell(x, y);
+    int step = std::abs(next - target);
+
+    if (next == target)
+    {
+        return;
+    }
+
+    //a neighbor the target could walk to is exactly 1 away
+    if ((step == 1 || step == stride) && distances[next] + bias == 1)
+    {
+        shift(next);
+    }
+    else
+    {
+        target = next;
+        rebuild();
+    }
+}
+
+
+/********************************************************************
+** Function: distance: Returns the walking distance from a cell to
+ *              the target.
+** Params:   int x: x-coordinate.
+ *           int y: y-coordinate.
+** Returns:  int: number of steps, or UNREACHABLE.
+*********************************************************************/
+int FlowField::distance(int x, int y) const
+{
+    int stored = distances[cell(x, y)];
+    return (stored == WALL) ? UNREACHABLE : stored + bias;
+}
+
+
+/********************************************************************
+** Function: next: Returns the step that takes a chaser at a cell
+ *              closest to the target.
+** Params:   int x: x-coordinate of the chaser.
+ *           int y: y-coordinate of the chaser.
+** Returns:  Step: direction to step in, STAY if the chaser is on
+ *              the target or can't reach it.
+*********************************************************************/
+FlowField::Step FlowField::next(int x, int y) const
+{
+    const int *here = &distances[cell(x, y)];
+
+    //the bias is the same everywhere, so stored distances compare
+    // the same way real ones do
+    Step best = STAY;
+    int best_distance = *here;
+
+    if (here[-stride] < best_distance)
+    {
+        best = UP;
+        best_distance = here[-stride];
+    }
+    if (here[1] < best_distance)
+    {
+        best = RIGHT;
+        best_distance = here[1];
+    }
+    if (here[stride] < best_distance)
+    {
+        best = DOWN;
+        best_distance = here[stride];
+    }
+    if (here[-1] < best_distance)
+    {
+        best = LEFT;
+    }
+
+    return best;
+}
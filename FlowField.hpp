@@ -0,0 +1,172 @@
+/*********************************************************************
+** Program name: FlowField.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 22, 2019 at 11:15 AM
+** Description: Class specification file for FlowField. FlowField
+ *              holds the walking distance from every cell of the
+ *              board to a target, found with a breadth-first search.
+ *              Anything chasing the target only has to step to the
+ *              neighbor with the smallest distance, so one field is
+ *              shared by every chaser and its cost depends on the
+ *              size of the board, not on how many are chasing.
+ *              When the target moves to a neighboring cell the field
+ *              is updated instead of searched again. Every move on a
+ *              grid changes the distance of each cell by exactly one,
+ *              so only the cells that get closer are visited and all
+ *              the others get one further away through a shared bias.
+ *              The field has a border of blocked cells around the
+ *              board, so looking at a neighbor never needs a bounds
+ *              check. It listens to the board and takes the blocked
+ *              cells again after every batch of tile changes.
+*********************************************************************/
+
+
+#ifndef FLOW_FIELD_HPP
+#define FLOW_FIELD_HPP
+
+#include <vector>
+#include "BoardListener.hpp"
+
+class FlowField : public BoardListener
+{
+public:
+    //distance reported for cells that can't reach the target
+    static const int UNREACHABLE;
+
+    //directions returned by next, numbered like Game's Direction
+    enum Step
+    {
+        STAY = 0,
+        UP,
+        RIGHT,
+        DOWN,
+        LEFT
+    };
+
+private:
+    //stored distance of blocked and unreachable cells, larger than
+    // any real distance so they never look like a way forward
+    static const int WALL;
+
+    //rebuild when the bias gets this large, so it never overflows
+    static const int MAX_BIAS;
+
+    int rows;
+    int cols;
+    int stride;
+    int target;
+    int bias;
+
+    //distance of each padded cell, less the bias
+    std::vector<int> distances;
+
+    //blocked flag of each padded cell, the border is always blocked
+    std::vector<unsigned char> blocked;
+
+    //search queue, reserved for every cell so searches never allocate
+    std::vector<int> queue;
+
+
+    /********************************************************************
+    ** Function: cell: Returns the padded index of a board cell.
+    ** Params:   int x: x-coordinate.
+     *           int y: y-coordinate.
+    ** Returns:  int: index into distances and blocked.
+    *********************************************************************/
+    int cell(int x, int y) const;
+
+
+    /********************************************************************
+    ** Function: rebuild: Searches the whole board again from the
+     *              target and resets the bias.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void rebuild();
+
+
+    /********************************************************************
+    ** Function: shift: Updates the field for a target that moved to a
+     *              neighboring cell. Starting at the new target, only
+     *              cells whose old distance grows by one along the way
+     *              are visited, those are the cells that get one step
+     *              closer. The rest get one step further away by
+     *              raising the bias.
+    ** Params:   int next: padded index of the new target.
+    ** Returns:  None
+    *********************************************************************/
+    void shift(int next);
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor: Creates a field for a board with nothing
+     *              blocked and the target at (x, y).
+    ** Params:   int rows: number of rows of the board.
+     *           int cols: number of columns of the board.
+     *           int x: x-coordinate of the target.
+     *           int y: y-coordinate of the target.
+    ** Returns:  None
+    *********************************************************************/
+    FlowField(int rows, int cols, int x, int y);
+
+
+    /********************************************************************
+    ** Function: setBlocked: Marks a cell as one that can't be walked
+     *              through, and searches again.
+    ** Params:   int x: x-coordinate.
+     *           int y: y-coordinate.
+     *           bool is_blocked: true to block the cell.
+    ** Returns:  None
+    *********************************************************************/
+    void setBlocked(int x, int y, bool is_blocked);
+
+
+    /********************************************************************
+    ** Function: tilesChanged: Takes the blocked cells of the changed
+     *              tiles from the board and searches again.
+    ** Params:   const Board &board: the board that changed.
+     *           int left: x-coordinate of the first changed column.
+     *           int top: y-coordinate of the first changed row.
+     *           int right: x-coordinate of the last changed column.
+     *           int bottom: y-coordinate of the last changed row.
+    ** Returns:  None
+    *********************************************************************/
+    virtual void tilesChanged(const Board &board, int left, int top,
+                              int right, int bottom) override;
+
+
+    /********************************************************************
+    ** Function: moveTarget: Moves the target. A move to a neighboring
+     *              cell updates the field, any other move, such as
+     *              through a worm hole, searches again.
+    ** Params:   int x: new x-coordinate of the target.
+     *           int y: new y-coordinate of the target.
+    ** Returns:  None
+    *********************************************************************/
+    void moveTarget(int x, int y);
+
+
+    /********************************************************************
+    ** Function: distance: Returns the walking distance from a cell to
+     *              the target.
+    ** Params:   int x: x-coordinate.
+     *           int y: y-coordinate.
+    ** Returns:  int: number of steps, or UNREACHABLE.
+    *********************************************************************/
+    int distance(int x, int y) const;
+
+
+    /********************************************************************
+    ** Function: next: Returns the step that takes a chaser at a cell
+     *              closest to the target.
+    ** Params:   int x: x-coordinate of the chaser.
+     *           int y: y-coordinate of the chaser.
+    ** Returns:  Step: direction to step in, STAY if the chaser is on
+     *              the target or can't reach it.
+    *********************************************************************/
+    Step next(int x, int y) const;
+
+};
+
+#endif
@@ -0,0 +1,224 @@
+/*********************************************************************
+** Program name: FogOfWar.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 13, 2019 at 1:40 PM
+** Description: Class implementation file for FogOfWar. FogOfWar
+ *              keeps track of which cells of the board the traveler
+ *              has explored. Everything within the visibility radius
+ *              (a square around the traveler) is revealed as they
+ *              move. The explored set is a bitset with one bit per
+ *              cell. A single step only reveals the new edge of the
+ *              square that came into view, so each step costs
+ *              O(radius) no matter how large the board is. Cells
+ *              that have not been explored are drawn as unknown.
+*********************************************************************/
+
+
+#include <bitset>
+#include <cstdlib>
+#include "FogOfWar.hpp"
+
+using std::uint64_t;
+
+//initialize static fog constants
+const char FogOfWar::UNKNOWN_ICON = '?';
+const int FogOfWar::DEFAULT_RADIUS = 2;
+
+//bits per word of the explored set
+static const int WORD_BITS = 64;
+
+/********************************************************************
+** Function: Constructor/default: Creates an explored set for a
+ *              board with nothing explored yet.
+** Params:   int rows: number of rows of the board.
+ *              default = 0.
+ *           int cols: number of columns of the board.
+ *              default = 0.
+ *           int radius: how far the traveler can see.
+ *              default = DEFAULT_RADIUS.
+** Returns:  None
+*********************************************************************/
+FogOfWar::FogOfWar(int rows, int cols, int radius)
+        : rows(rows), cols(cols), radius(radius),
+          words_per_row((cols + WORD_BITS - 1) / WORD_BITS),
+          explored_count(0),
+          explored(static_cast<size_t>(rows) * words_per_row, 0)
+{}
+
+
+/********************************************************************
+** Function: revealRow: Marks a horizontal run of cells on one row
+ *              as explored, a whole 64-bit word at a time. The run
+ *              is clipped to the board.
+** Params:   int y: row to reveal.
+ *           int x_start: first column of the run.
+ *           int x_end: last column of the run.
+** Returns:  None
+*********************************************************************/
+void FogOfWar::revealRow(int y, int x_start, int x_end)
+{
+    //clip the run to the board
+    if (y < 0 || y >= rows)
+    {
+        return;
+    }
+    if (x_start < 0)
+    {
+        x_start = 0;
+    }
+    if (x_end > cols - 1)
+    {
+        x_end = cols - 1;
+    }
+    if (x_start > x_end)
+    {
+        return;
+    }
+
+    uint64_t *row = &explored[static_cast<size_t>(y) * words_per_row];
+
+    //set the bits of each word the run covers
+    for (int word = x_start / WORD_BITS; word <= x_end / WORD_BITS; word++)
+    {
+        int first = (word == x_start / WORD_BITS) ? x_start % WORD_BITS : 0;
+        int last = (word == x_end / WORD_BITS) ? x_end % WORD_BITS : WORD_BITS - 1;
+
+        uint64_t mask = (~uint64_t(0) >> (WORD_BITS - 1 - last)) & (~uint64_t(0) << first);
+
+        //only count the cells that were not explored before
+        explored_count += std::bitset<WORD_BITS>(mask & ~row[word]).count();
+        row[word] |= mask;
+    }
+}
+
+
+/********************************************************************
+** Function: revealColumn: Marks a vertical run of cells on one
+ *              column as explored. The run is clipped to the board.
+** Params:   int x: column to reveal.
+ *           int y_start: first row of the run.
+ *           int y_end: last row of the run.
+** Returns:  None
+*********************************************************************/
+void FogOfWar::revealColumn(int x, int y_start, int y_end)
+{
+    //clip the run to the board
+    if (x < 0 || x >= cols)
+    {
+        return;
+    }
+    if (y_start < 0)
+    {
+        y_start = 0;
+    }
+    if (y_end > rows - 1)
+    {
+        y_end = rows - 1;
+    }
+
+    uint64_t bit = uint64_t(1) << (x % WORD_BITS);
+
+    for (int y=y_start; y<=y_end; y++)
+    {
+        uint64_t &word = explored[static_cast<size_t>(y) * words_per_row + x / WORD_BITS];
+
+        if (!(word & bit))
+        {
+            word |= bit;
+            explored_count++;
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: reveal: Reveals the whole visibility square around the
+ *              specified coordinates. Used for the starting position
+ *              and for jumps, such as going through a worm hole.
+** Params:   int x: x-coordinate of the traveler.
+ *           int y: y-coordinate of the traveler.
+** Returns:  None
+*********************************************************************/
+void FogOfWar::reveal(int x, int y)
+{
+    for (int i=y-radius; i<=y+radius; i++)
+    {
+        revealRow(i, x - radius, x + radius);
+    }
+}
+
+
+/********************************************************************
+** Function: step: Updates the explored set after the traveler moved.
+ *              A move to an adjacent cell only reveals the row or
+ *              column that came into view. Any other move falls back
+ *              to revealing the whole square.
+** Params:   int from_x: x-coordinate before the move.
+ *           int from_y: y-coordinate before the move.
+ *           int to_x: x-coordinate after the move.
+ *           int to_y: y-coordinate after the move.
+** Returns:  None
+*********************************************************************/
+void FogOfWar::step(int from_x, int from_y, int to_x, int to_y)
+{
+    int dx = to_x - from_x;
+    int dy = to_y - from_y;
+
+    if (std::abs(dx) + std::abs(dy) != 1)
+    {
+        //didn't move, nothing new to see
+        if (dx == 0 && dy == 0)
+        {
+            return;
+        }
+
+        //jumped somewhere, reveal everything around the new position
+        reveal(to_x, to_y);
+    }
+    else if (dx != 0)
+    {
+        //moved left or right, the column at the leading edge came into view
+        revealColumn(to_x + dx * radius, to_y - radius, to_y + radius);
+    }
+    else
+    {
+        //moved up or down, the row at the leading edge came into view
+        revealRow(to_y + dy * radius, to_x - radius, to_x + radius);
+    }
+}
+
+
+/********************************************************************
+** Function: isExplored: Checks if a cell has been explored.
+** Params:   int x: x-coordinate of the cell.
+ *           int y: y-coordinate of the cell.
+** Returns:  bool: true if the traveler has been near the cell.
+*********************************************************************/
+bool FogOfWar::isExplored(int x, int y) const
+{
+    return (explored[static_cast<size_t>(y) * words_per_row + x / WORD_BITS]
+            >> (x % WORD_BITS)) & 1;
+}
+
+
+/********************************************************************
+** Function: getRadius: Returns the visibility radius.
+** Params:   None
+** Returns:  int: visibility radius.
+*********************************************************************/
+int FogOfWar::getRadius() const
+{
+    return radius;
+}
+
+
+/********************************************************************
+** Function: getExploredCount: Returns how many cells have been
+ *              explored so far.
+** Params:   None
+** Returns:  long: number of explored cells.
+*********************************************************************/
+long FogOfWar::getExploredCount() const
+{
+    return explored_count;
+}
@@ -0,0 +1,130 @@
+/*********************************************************************
+** Program name: FogOfWar.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 13, 2019 at 1:40 PM
+** Description: Class specification file for FogOfWar. FogOfWar
+ *              keeps track of which cells of the board the traveler
+ *              has explored. Everything within the visibility radius
+ *              (a square around the traveler) is revealed as they
+ *              move. The explored set is a bitset with one bit per
+ *              cell. A single step only reveals the new edge of the
+ *              square that came into view, so each step costs
+ *              O(radius) no matter how large the board is. Cells
+ *              that have not been explored are drawn as unknown.
+*********************************************************************/
+
+
+#ifndef FOG_OF_WAR_HPP
+#define FOG_OF_WAR_HPP
+
+#include <cstdint>
+#include <vector>
+
+class FogOfWar
+{
+public:
+    //icon drawn in place of unexplored cells
+    static const char UNKNOWN_ICON;
+
+    //visibility radius used when none is given
+    static const int DEFAULT_RADIUS;
+
+private:
+    int rows;
+    int cols;
+    int radius;
+    int words_per_row;
+    long explored_count;
+    std::vector<std::uint64_t> explored;
+
+    /********************************************************************
+    ** Function: revealRow: Marks a horizontal run of cells on one row
+     *              as explored, a whole 64-bit word at a time. The run
+     *              is clipped to the board.
+    ** Params:   int y: row to reveal.
+     *           int x_start: first column of the run.
+     *           int x_end: last column of the run.
+    ** Returns:  None
+    *********************************************************************/
+    void revealRow(int y, int x_start, int x_end);
+
+
+    /********************************************************************
+    ** Function: revealColumn: Marks a vertical run of cells on one
+     *              column as explored. The run is clipped to the board.
+    ** Params:   int x: column to reveal.
+     *           int y_start: first row of the run.
+     *           int y_end: last row of the run.
+    ** Returns:  None
+    *********************************************************************/
+    void revealColumn(int x, int y_start, int y_end);
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Creates an explored set for a
+     *              board with nothing explored yet.
+    ** Params:   int rows: number of rows of the board.
+     *              default = 0.
+     *           int cols: number of columns of the board.
+     *              default = 0.
+     *           int radius: how far the traveler can see.
+     *              default = DEFAULT_RADIUS.
+    ** Returns:  None
+    *********************************************************************/
+    FogOfWar(int rows = 0, int cols = 0, int radius = DEFAULT_RADIUS);
+
+
+    /********************************************************************
+    ** Function: reveal: Reveals the whole visibility square around the
+     *              specified coordinates. Used for the starting position
+     *              and for jumps, such as going through a worm hole.
+    ** Params:   int x: x-coordinate of the traveler.
+     *           int y: y-coordinate of the traveler.
+    ** Returns:  None
+    *********************************************************************/
+    void reveal(int x, int y);
+
+
+    /********************************************************************
+    ** Function: step: Updates the explored set after the traveler moved.
+     *              A move to an adjacent cell only reveals the row or
+     *              column that came into view. Any other move falls back
+     *              to revealing the whole square.
+    ** Params:   int from_x: x-coordinate before the move.
+     *           int from_y: y-coordinate before the move.
+     *           int to_x: x-coordinate after the move.
+     *           int to_y: y-coordinate after the move.
+    ** Returns:  None
+    *********************************************************************/
+    void step(int from_x, int from_y, int to_x, int to_y);
+
+
+    /********************************************************************
+    ** Function: isExplored: Checks if a cell has been explored.
+    ** Params:   int x: x-coordinate of the cell.
+     *           int y: y-coordinate of the cell.
+    ** Returns:  bool: true if the traveler has been near the cell.
+    *********************************************************************/
+    bool isExplored(int x, int y) const;
+
+
+    /********************************************************************
+    ** Function: getRadius: Returns the visibility radius.
+    ** Params:   None
+    ** Returns:  int: visibility radius.
+    *********************************************************************/
+    int getRadius() const;
+
+
+    /********************************************************************
+    ** Function: getExploredCount: Returns how many cells have been
+     *              explored so far.
+    ** Params:   None
+    ** Returns:  long: number of explored cells.
+    *********************************************************************/
+    long getExploredCount() const;
+
+};
+
+#endif
@@ -20,9 +20,10 @@
 *********************************************************************/
 
 
+#include <cctype>
+#include <limits>
 #include "Game.hpp"
 
-using std::cout;
 using std::endl;
 using std::string;
 
@@ -32,6 +33,23 @@ const int Game::COLS = 10;
 const int Game::TRAVELER_START_X = 6;
 const int Game::TRAVELER_START_Y = 5;
 
+//initialize static game prompts
+const int Game::ACTION_CHOICES_SIZE = 6;
+const string Game::ACTION_CHOICES[] = {"Go Up",
+                                       "Go Right",
+                                       "Go Down",
+                                       "Go Left",
+                                       "Check Space",
+                                       "View Inventory"};
+const string Game::ACTION_PROMPT = "What do you want to do?";
+const string Game::WALL_MESSAGE = "You can't go there.";
+const string Game::INVENTORY_TITLE = "Your Inventory: ";
+const string Game::INVENTORY_PROMPT = "What do you want to do?";
+const string Game::COMMAND_HELP = "Or type a command, like 5R 3U C or goto 7,2";
+const string Game::COMMAND_PROMPT = "Enter a number between 1 and 6 or a command: ";
+const string Game::KEY_HELP = "Keys: W A S D or arrows to move, "
+                              "C check space, I inventory, Q quit";
+
 /********************************************************************
 ** Function: Constructor/default: Initializes a game object. Sets up
  *              the map and all map assets, such as the spaces, the
@@ -39,7 +57,9 @@ const int Game::TRAVELER_START_Y = 5;
 ** Params:   None
 ** Returns:  None
 *********************************************************************/
-Game::Game() : game_over(false)
+Game::Game() : fog(nullptr), terminal(nullptr), swarm(nullptr), trail(nullptr),
+        network(nullptr), routes(nullptr), ship_x(0), ship_y(0), respawn_steps(0),
+        game_over(false)
 {
     setupSpaces();
     setupAliens();
@@ -51,30 +71,11 @@ Game::Game() : game_over(false)
 /********************************************************************
 ** Function: Destructor: Responsible for de-allocating all Space
  *              objects and pointing the board's pointer to nullptr.
- *              Also responsible for checking if the Space object has
- *              any item objects, then de-allocating those as well.
 ** Params:   None
 ** Returns:  None
 *********************************************************************/
 Game::~Game()
 {
-    //check and delete items left on the map
-    for (int y=0; y<ROWS; y++)
-    {
-        for (int x=0; x<COLS; x++)
-        {
-            //AsteroidObject spaces hold items
-            AsteroidObject *landmark =
-                    dynamic_cast<AsteroidObject*>(asteroid->getSpace(x, y));
-
-            if (landmark && landmark->hasTreasure())
-            {
-                //if there is an item there, delete it
-                delete landmark->getTreasure();
-            }
-        }
-    }
-
     //delete all space pointers
     for (int y=0; y<ROWS; y++)
     {
@@ -93,6 +94,30 @@ Game::~Game()
     //de-allocate human traveler pointer
     delete traveler;
     traveler = nullptr;
+
+    //de-allocate explored set, if fog of war was enabled
+    delete fog;
+    fog = nullptr;
+
+    //de-allocate key input, this restores the terminal
+    delete terminal;
+    terminal = nullptr;
+
+    //de-allocate roaming aliens, if they were enabled
+    delete swarm;
+    swarm = nullptr;
+
+    //de-allocate the hunting flow field, if aliens hunt
+    delete trail;
+    trail = nullptr;
+
+    //de-allocate the travel times, if worm holes are linked
+    delete network;
+    network = nullptr;
+
+    //de-allocate the routes for goto
+    delete routes;
+    routes = nullptr;
 }
 
 
@@ -118,13 +143,13 @@ void Game::start()
     //print story, objective, time limit, and legend
     //open border
     menu.printBorder();
-    cout << endl;
+    IOBackend::out() << endl;
     //story
-    cout << STORY << endl << endl;
+    IOBackend::out() << STORY << endl << endl;
     //objective
-    cout << OBJECTIVE << endl << endl;
+    IOBackend::out() << OBJECTIVE << endl << endl;
     //time limit
-    cout << TIME_LIMIT << endl;
+    IOBackend::out() << TIME_LIMIT << endl;
     //close border
     menu.printBorder();
 
@@ -135,17 +160,57 @@ void Game::start()
         // initialized with dummy value, CHECK_SPACE, will be over-written
         Action user_selection = CHECK_SPACE;
 
+        //initialize turn counter, used by the allocation check
+        int turn = 0;
+
+        //read single keys, stays on between turns so keys typed while
+        // the map is printing are kept
+        if (terminal)
+        {
+            terminal->enable();
+        }
+
         //loop game play until user dies or completes the mission
         while (!game_over && traveler->getHealth() > 0 && traveler->getOxygen() > 0)
         {
+            //turns must not allocate, checked when built with ALLOC_CHECK
+            AllocCounter::beginTurn();
+
             //print map and game stats
             print();
 
-            //print menu and get user selection
-            user_selection = playMenu();
+            if (terminal)
+            {
+                //wait for a key
+                user_selection = keyMenu();
+
+                //checking the space or inventory prompts for whole lines
+                if (user_selection == CHECK_SPACE || user_selection == CHECK_INVENTORY)
+                {
+                    terminal->disable();
+                    performAction(user_selection);
+                    terminal->enable();
+                }
+                else
+                {
+                    performAction(user_selection);
+                }
+            }
+            else
+            {
+                //print menu and get user selection or command
+                playMenu();
+
+                //perform every step of it before printing again
+                runCommands();
+            }
 
-            //perform action
-            performAction(user_selection);
+            AllocCounter::endTurn(++turn);
+        }
+
+        if (terminal)
+        {
+            terminal->disable();
         }
 
         if (traveler->getHealth() < 1 || traveler->getOxygen() < 1)
@@ -161,10 +226,355 @@ void Game::start()
 }
 
 
+/********************************************************************
+** Function: runScript: Plays the game from a script instead of the
+ *              menus. Each action in the script is one turn:
+ *              U, R, D, L move, C checks the space, and I opens the
+ *              inventory, where the numbers that follow use those
+ *              items. Letters may be upper or lower case, spaces
+ *              between them are optional, and # starts a comment
+ *              that runs to the end of the line. Prompts are
+ *              answered with yes and nothing is printed until the
+ *              script runs out or the game ends, then a summary is
+ *              printed.
+** Params:   istream &script: stream to read the script from.
+** Returns:  None
+*********************************************************************/
+void Game::runScript(std::istream &script)
+{
+    //answer prompts automatically and silence the screen
+    Menu::setAutoConfirm(true);
+    NullIO silent;
+    IOBackend *screen = IOBackend::setCurrent(&silent);
+
+    //initialize counters for the summary
+    int turn = 0;
+    int skipped = 0;
+    bool in_inventory = false;
+    char token = '\0';
+
+    //read actions until the script runs out or the game ends
+    while (!game_over && traveler->getHealth() > 0 && traveler->getOxygen() > 0
+           && script.get(token))
+    {
+        //skip whitespace and comments
+        if (std::isspace(static_cast<unsigned char>(token)))
+        {
+            continue;
+        }
+        if (token == '#')
+        {
+            script.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            continue;
+        }
+
+        //turns must not allocate, checked when built with ALLOC_CHECK
+        AllocCounter::beginTurn();
+
+        if (std::isdigit(static_cast<unsigned char>(token)))
+        {
+            //read the rest of the item index
+            int index = token - '0';
+            while (std::isdigit(script.peek()))
+            {
+                index = index * 10 + (script.get() - '0');
+            }
+
+            //item indices only count inside the inventory
+            if (in_inventory && index >= 1 && index <= traveler->getInventory()->stackCount())
+            {
+                traveler->selectItem(index);
+            }
+            else
+            {
+                skipped++;
+                continue;
+            }
+        }
+        else
+        {
+            in_inventory = false;
+
+            switch (std::toupper(static_cast<unsigned char>(token)))
+            {
+                case 'U' :
+                    performAction(GO_UP);
+                    break;
+                case 'R' :
+                    performAction(GO_RIGHT);
+                    break;
+                case 'D' :
+                    performAction(GO_DOWN);
+                    break;
+                case 'L' :
+                    performAction(GO_LEFT);
+                    break;
+                case 'C' :
+                    performAction(CHECK_SPACE);
+                    break;
+                case 'I' :
+                    in_inventory = true;
+                    break;
+                default :
+                    //not an action, skip it
+                    skipped++;
+                    continue;
+            }
+        }
+
+        AllocCounter::endTurn(++turn);
+    }
+
+    //restore the screen and prompts
+    IOBackend::setCurrent(screen);
+    Menu::setAutoConfirm(false);
+
+    //print the summary
+    string result = "Script ended";
+    if (traveler->getHealth() < 1 || traveler->getOxygen() < 1)
+    {
+        result = "Died";
+    }
+    else if (game_over)
+    {
+        result = "Escaped";
+    }
+
+    menu.printBorder();
+    IOBackend::out() << endl;
+    IOBackend::out() << "Result: " << result << endl;
+    IOBackend::out() << "Turns: " << turn << "\tSkipped tokens: " << skipped << endl;
+    IOBackend::out() << "Health: " << traveler->getHealth()
+         << "\tOxygen: " << traveler->getOxygen() << endl;
+    IOBackend::out() << "Position: " << traveler->getX() << ", " << traveler->getY() << endl;
+    IOBackend::out() << "Plutonium ore: " << traveler->getInventory()->count(PLUTONIUMORE)
+         << "\tShip parts: " << traveler->getInventory()->count(SHIPPART) << endl;
+    menu.printBorder();
+}
+
+
+/********************************************************************
+** Function: enableFogOfWar: Turns on fog of war. Only the cells
+ *              within the visibility radius of where the traveler
+ *              has been are shown on the map.
+** Params:   int radius: how far the traveler can see.
+ *              default = FogOfWar::DEFAULT_RADIUS.
+** Returns:  None
+*********************************************************************/
+void Game::enableFogOfWar(int radius)
+{
+    //replace any existing explored set
+    delete fog;
+    fog = new FogOfWar(ROWS, COLS, radius);
+
+    //the traveler can see around where they start
+    fog->reveal(traveler->getX(), traveler->getY());
+
+    //hide unexplored cells when printing the board
+    asteroid->setFog(fog);
+}
+
+
+/********************************************************************
+** Function: enableRawInput: Plays with single key presses instead
+ *              of the numbered action menu. W, A, S, D or the arrow
+ *              keys move, C checks the space, I opens the
+ *              inventory, and Q quits. Prompts for a whole line
+ *              still use normal line input.
+** Params:   None
+** Returns:  bool: true if input is a terminal that supports it.
+*********************************************************************/
+bool Game::enableRawInput()
+{
+    RawTerminal *keys = new RawTerminal();
+
+    //keys can only be read one at a time from a terminal
+    if (!keys->isTerminal())
+    {
+        delete keys;
+        return false;
+    }
+
+    delete terminal;
+    terminal = keys;
+    return true;
+}
+
+
+/********************************************************************
+** Function: enableAliens: Lets aliens roam the asteroid. They take
+ *              a random step every time the traveler moves, and
+ *              attack if they step onto the traveler. These are in
+ *              addition to the aliens hiding in craters and under
+ *              space rocks.
+** Params:   int count: number of roaming aliens.
+ *           unsigned int seed: seed for where they start and go.
+ *              default = time(0).
+** Returns:  None
+*********************************************************************/
+void Game::enableAliens(int count, unsigned int seed)
+{
+    //replace any existing swarm
+    delete swarm;
+    swarm = new AlienSwarm(asteroid->getBlockers(), count, seed);
+}
+
+
+/********************************************************************
+** Function: enableHunting: Makes roaming aliens hunt the traveler
+ *              instead of wandering. They all follow one flow field
+ *              that is updated as the traveler moves and as tiles
+ *              of the board change.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Game::enableHunting()
+{
+    if (trail)
+    {
+        asteroid->removeListener(trail);
+        delete trail;
+    }
+    trail = new FlowField(ROWS, COLS, traveler->getX(), traveler->getY());
+
+    //hunters go around the cells nobody can cross, and the field
+    // follows tiles that change later
+    trail->tilesChanged(*asteroid, 0, 0, COLS - 1, ROWS - 1);
+    asteroid->addListener(trail);
+}
+
+
+/********************************************************************
+** Function: enableRespawn: Makes aliens that ran away from a crater
+ *              or space rock come back and hide there again after
+ *              a number of steps.
+** Params:   int steps: steps until an alien comes back.
+** Returns:  None
+*********************************************************************/
+void Game::enableRespawn(int steps)
+{
+    respawn_steps = steps;
+}
+
+
+/********************************************************************
+** Function: enableOxygenLeak: Gives the traveler's suit a leak
+ *              that loses one oxygen point every few steps, on top
+ *              of the oxygen used by moving.
+** Params:   int steps: steps between losing oxygen.
+** Returns:  None
+*********************************************************************/
+void Game::enableOxygenLeak(int steps)
+{
+    TimerWheel::Event leak = {OXYGEN_LEAK, 0, 0, 1};
+    events.schedule(steps, leak, steps);
+}
+
+
+/********************************************************************
+** Function: enableMeteors: Makes a meteor shower hit the asteroid
+ *              every few steps, turning the ground in a 3x3 area
+ *              around a random cell into craters.
+** Params:   int steps: steps between meteor showers.
+** Returns:  None
+*********************************************************************/
+void Game::enableMeteors(int steps)
+{
+    TimerWheel::Event shower = {METEOR_SHOWER, 0, 0, 0};
+    events.schedule(steps, shower, steps);
+}
+
+
+/********************************************************************
+** Function: enableLinkedWormholes: Links the worm holes to each
+ *              other as listed in the level design, so each one
+ *              always leads to the same place, and works out the
+ *              travel times between every pair of cells, used to
+ *              show how far away the ship is.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Game::enableLinkedWormholes()
+{
+    //link each listed worm hole to its other end
+    for (int i=0; i<GameDefaults::WORMHOLE_LINK_SIZE; i++)
+    {
+        const GameDefaults::WormholeLink &link = WORMHOLE_LINKS_LT[i];
+        Wormhole *hole = dynamic_cast<Wormhole*>(asteroid->getSpace(link.from_x, link.from_y));
+        if (hole)
+        {
+            hole->setLink(link.to_x, link.to_y);
+        }
+    }
+
+    //replace any existing travel times, and keep them up to date
+    if (network)
+    {
+        asteroid->removeListener(network);
+        delete network;
+    }
+    network = new TravelGraph();
+    network->setLinks(WORMHOLE_LINKS_LT, GameDefaults::WORMHOLE_LINK_SIZE);
+    network->build(*asteroid);
+    asteroid->addListener(network);
+}
+
+
+/********************************************************************
+** Function: setTheme: Sets the theme used to color the map.
+** Params:   const Theme *theme: theme to use, or nullptr to print
+ *              the map without colors.
+** Returns:  None
+*********************************************************************/
+void Game::setTheme(const Theme *theme)
+{
+    asteroid->setTheme(theme);
+}
+
+
+/********************************************************************
+** Function: getFogOfWar: Returns the cells the traveler has
+ *              explored so far.
+** Params:   None
+** Returns:  const FogOfWar *: explored set, or nullptr if fog of
+ *              war is not enabled.
+*********************************************************************/
+const FogOfWar *Game::getFogOfWar() const
+{
+    return fog;
+}
+
+
+/********************************************************************
+** Function: getTravelGraph: Returns the travel times between cells,
+ *              for bots and hints.
+** Params:   None
+** Returns:  const TravelGraph *: travel times, or nullptr if worm
+ *              holes are not linked.
+*********************************************************************/
+const TravelGraph *Game::getTravelGraph() const
+{
+    return network;
+}
+
+
+/********************************************************************
+** Function: getBoard: Returns the game board, for tools that
+ *              inspect or export the level.
+** Params:   None
+** Returns:  const Board *: the game board.
+*********************************************************************/
+const Board *Game::getBoard() const
+{
+    return asteroid;
+}
+
+
 /********************************************************************
 ** Function: setupSpaces: Creates board instance and space objects
  *              according to level design and inserts them into the
- *              game board.
+ *              game board. Builds the worm hole destinations, which
+ *              are built again whenever tiles change.
 ** Params:   None
 ** Returns:  None
 *********************************************************************/
@@ -177,8 +587,6 @@ void Game::setupSpaces()
     int x = 0;
     int y = 0;
     SpaceType type = DEFAULTSPACE;
-    string description = "";
-    char icon = '\0';
 
     //set up the map spaces according to level design
     for (int i=0; i<GameDefaults::SPACE_LOCATION_SIZE; i++)
@@ -188,33 +596,34 @@ void Game::setupSpaces()
         y = SPACE_LOCATIONS_LT[i].y;
         type = SPACE_LOCATIONS_LT[i].type;
 
-        description = SPACE_CONFIG_LT[type].description_default;
-        icon = SPACE_CONFIG_LT[type].icon_default;
+        Space *space = SpaceFactory::create(x, y, type);
+        asteroid->setSpace(x, y, space);
 
-        switch (type)
+        //remember where the ship is
+        if (type == ROCKETSHIP)
         {
-            case ROCKETSHIP :
-                asteroid->setSpace(x, y, new Rocketship(x, y, type, description, icon));
-                break;
-            case CRATER :
-                asteroid->setSpace(x, y, new Crater(x, y, type, description, icon));
-                break;
-            case SPACEROCK :
-                asteroid->setSpace(x, y, new SpaceRock(x, y, type, description, icon));
-                break;
-            case WORMHOLE :
-                asteroid->setSpace(x, y, new Wormhole(x, y, type, description, icon));
-                break;
-            case GROUND :
-                asteroid->setSpace(x, y, new Ground(x, y, type, description, icon));
-                break;
-            default :
-                break;
+            ship_x = x;
+            ship_y = y;
+        }
+
+        //worm holes send you somewhere on this board
+        if (type == WORMHOLE)
+        {
+            static_cast<Wormhole*>(space)->setDestinations(&destinations);
         }
     }
 
     //link the spaces together
     asteroid->linkSpaces();
+
+    //worm holes can send you to any cell of the board
+    destinations.build(*asteroid);
+    asteroid->addListener(&destinations);
+
+    //goto finds its way around chasms, sized up front so walking
+    // doesn't allocate
+    routes = new JumpPointSearch(asteroid->getBlockers());
+    route.reserve(ROWS * COLS);
 }
 
 
@@ -230,7 +639,6 @@ void Game::setupAliens()
     int x = 0;
     int y = 0;
     AlienType type = KHALEESI;
-    string description = "";
 
     //hide aliens on the map according to level design
     for (int i=0; i<GameDefaults::ALIEN_LOCATION_SIZE; i++)
@@ -240,14 +648,12 @@ void Game::setupAliens()
         y = ALIEN_LOCATIONS_LT[i].y;
         type = ALIEN_LOCATIONS_LT[i].type;
 
-        description = ALIEN_DESC_LT[type].description;
-
         //cast space to AsteroidObject, only those can hide aliens
         AsteroidObject *landmark = dynamic_cast<AsteroidObject*>(asteroid->getSpace(x, y));
         if (landmark)
         {
             //hide alien in space
-            landmark->setAlien(description);
+            landmark->setAlien(type);
         }
     }
 }
@@ -265,9 +671,6 @@ void Game::setupTreasure()
     int x = 0;
     int y = 0;
     ItemType type = HEALTHPACK;
-    string name = "";
-    string description = "";
-    Item *new_item = nullptr;
 
     //hide items on the map according to level design
     for (int i=0; i<GameDefaults::ITEM_LOCATION_SIZE; i++)
@@ -277,18 +680,12 @@ void Game::setupTreasure()
         y = ITEM_LOCATIONS_LT[i].y;
         type = ITEM_LOCATIONS_LT[i].type;
 
-        name = ITEM_DESC_LT[type].name;
-        description = ITEM_DESC_LT[type].description;
-
         //cast space to AsteroidObject, only those can hide items
         AsteroidObject *landmark = dynamic_cast<AsteroidObject*>(asteroid->getSpace(x, y));
         if (landmark)
         {
-            //create new item
-            new_item = new Item(type, name, description);
-
             //hide item in space
-            landmark->setTreasure(new_item);
+            landmark->setTreasure(Item(type));
         }
     }
 }
@@ -296,8 +693,8 @@ void Game::setupTreasure()
 
 /********************************************************************
 ** Function: setupTraveler: Creates human instance at default
- *              location coordinates. Creates and gives the traveler
- *              4 health packs.
+ *              location coordinates. Gives the traveler 4 health
+ *              packs.
 ** Params:   None
 ** Returns:  None
 *********************************************************************/
@@ -308,16 +705,10 @@ void Game::setupTraveler()
 
     const int HEALTH_PACK_COUNT = 4;
 
-    //create and give traveler 4 health packs
+    //give traveler 4 health packs
     for (int i=0; i<HEALTH_PACK_COUNT; i++)
     {
-        traveler->addInventory(
-                new Item(
-                        HEALTHPACK,
-                        ITEM_DESC_LT[HEALTHPACK].name,
-                        ITEM_DESC_LT[HEALTHPACK].description
-                        )
-                );
+        traveler->addInventory(Item(HEALTHPACK));
     }
 }
 
@@ -326,25 +717,175 @@ void Game::setupTraveler()
 ** Function: playMenu: Prints a menu of actions to perform and
  *              prompts user to choose one. They can choose to go up,
  *              go right, go down, go left, check the space they are
- *              in, or look in their inventory.
+ *              in, or look in their inventory. Instead of a number
+ *              they can type a compound command, such as "5R 3U C"
+ *              or "goto 7,2". The choice is stored in commands.
 ** Params:   None
-** Returns:  Action: user's selected action.
+** Returns:  None
 *********************************************************************/
-Game::Action Game::playMenu()
+void Game::playMenu()
 {
-    //initialize prompts
-    const int CHOICES_SIZE = 6;
-    const string ACTION_PROMPT = "What do you want to do?";
-    const string CHOICES[] = {"Go Up",
-                              "Go Right",
-                              "Go Down",
-                              "Go Left",
-                              "Check Space",
-                              "View Inventory"};
-
-    //prompt user for selection and return it
-    return static_cast<Action>
-        (menu.chooseOne(CHOICES, CHOICES_SIZE, ACTION_PROMPT));
+    //print the choices
+    menu.printChoices(ACTION_CHOICES, ACTION_CHOICES_SIZE, ACTION_PROMPT);
+    IOBackend::out() << COMMAND_HELP << endl;
+
+    //prompt until the user enters a choice or a valid command
+    int choice = 0;
+    while (true)
+    {
+        IOBackend::out() << COMMAND_PROMPT << std::flush;
+        const string &input = ValidateInput::readLine();
+
+        if (ValidateInput::parseInteger(input, choice))
+        {
+            //a single action from the menu
+            if (choice >= GO_UP && choice <= CHECK_INVENTORY)
+            {
+                commands.setSingle(static_cast<CommandBatch::Command>(choice));
+                return;
+            }
+        }
+        else if (commands.parse(input))
+        {
+            return;
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: runCommands: Runs every step of commands as one turn,
+ *              without printing the map in between. Stops early if
+ *              the traveler hits a wall or dies. Checking the space
+ *              or the inventory prompts the user, so it is always
+ *              the last step run.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Game::runCommands()
+{
+    for (int i=0; i<commands.size(); i++)
+    {
+        const CommandBatch::Step &step = commands.getStep(i);
+
+        switch (step.command)
+        {
+            case CommandBatch::CHECK_SPACE :
+            case CommandBatch::CHECK_INVENTORY :
+                //interactions prompt the user, so they end the batch.
+                // Commands are numbered like Action.
+                performAction(static_cast<Action>(step.command));
+                return;
+            case CommandBatch::GOTO :
+                if (!walkTo(step.x, step.y))
+                {
+                    return;
+                }
+                break;
+            default :
+                //move commands map directly to Direction
+                for (int j=0; j<step.count; j++)
+                {
+                    if (!move(static_cast<Direction>(step.command))
+                        || traveler->getOxygen() < 1 || traveler->getHealth() < 1)
+                    {
+                        return;
+                    }
+                }
+                break;
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: walkTo: Moves the traveler one space at a time to the
+ *              specified coordinates, along the fewest steps
+ *              around anything that can't be crossed.
+** Params:   int x: x-coordinate to walk to.
+ *           int y: y-coordinate to walk to.
+** Returns:  bool: true if the traveler got there, false if there
+ *              is no way there or they died on the way.
+*********************************************************************/
+bool Game::walkTo(int x, int y)
+{
+    if (x < 0 || x >= COLS || y < 0 || y >= ROWS
+        || routes->search(traveler->getX(), traveler->getY(), x, y) == JumpPointSearch::UNREACHABLE)
+    {
+        menu.formatPrompt(WALL_MESSAGE);
+        return false;
+    }
+
+    route.clear();
+    routes->path(route);
+
+    //each cell of the route is next to the one before it
+    for (std::size_t i=0; i<route.size(); i++)
+    {
+        int next_x = route[i] % COLS;
+        int next_y = route[i] / COLS;
+        Direction direction = UP;
+
+        if (next_x != traveler->getX())
+        {
+            direction = (next_x > traveler->getX()) ? RIGHT : LEFT;
+        }
+        else if (next_y > traveler->getY())
+        {
+            direction = DOWN;
+        }
+
+        if (!move(direction) || traveler->getOxygen() < 1 || traveler->getHealth() < 1)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/********************************************************************
+** Function: keyMenu: Prints the keys that can be pressed and waits
+ *              for one that maps to an action. Other keys are
+ *              ignored. Used instead of playMenu with raw input.
+** Params:   None
+** Returns:  Action: action for the key, QUIT_GAME if the input
+ *              was closed.
+*********************************************************************/
+Game::Action Game::keyMenu()
+{
+    //ctrl-c arrives as a key in raw mode
+    const int CTRL_C = 3;
+
+    menu.printBorder();
+    IOBackend::out() << endl << KEY_HELP << endl;
+    menu.printBorder();
+
+    //wait for a key that means something
+    while (true)
+    {
+        switch (terminal->readKey())
+        {
+            case 'w' : case 'W' : case RawTerminal::KEY_UP :
+                return GO_UP;
+            case 'd' : case 'D' : case RawTerminal::KEY_RIGHT :
+                return GO_RIGHT;
+            case 's' : case 'S' : case RawTerminal::KEY_DOWN :
+                return GO_DOWN;
+            case 'a' : case 'A' : case RawTerminal::KEY_LEFT :
+                return GO_LEFT;
+            case 'c' : case 'C' :
+                return CHECK_SPACE;
+            case 'i' : case 'I' :
+                return CHECK_INVENTORY;
+            case 'q' : case 'Q' : case CTRL_C : case RawTerminal::END_OF_INPUT :
+                return QUIT_GAME;
+            default :
+                //not an action key, keep waiting
+                break;
+        }
+    }
 }
 
 
@@ -365,6 +906,9 @@ void Game::performAction(Action choice)
         case CHECK_INVENTORY :
             checkInventory();
             break;
+        case QUIT_GAME :
+            game_over = true;
+            break;
         default :
             //if it's not check space or check inventory,
             // then its to move. Move Action maps directly to Direction.
@@ -376,13 +920,16 @@ void Game::performAction(Action choice)
 
 /********************************************************************
 ** Function: move: Moves the character on space in specified
- *              direction. A successful movement subtracts one oxygen
- *              point.
+ *              direction. A successful movement subtracts the
+ *              oxygen cost of the new space's type, roaming aliens
+ *              move with it, and scheduled events move one step
+ *              forward.
 ** Params:   Direction direction: the direction in which to move the
  *              character.
-** Returns:  None
+** Returns:  bool: true if the traveler moved, false if there was
+ *              a wall or a space that can't be crossed in the way.
 *********************************************************************/
-void Game::move(Direction direction)
+bool Game::move(Direction direction)
 {
     //initialize variables to make the move
     int current_x = traveler->getX();
@@ -409,6 +956,13 @@ void Game::move(Direction direction)
             break;
     }
 
+    //a space that can't be crossed, like a chasm, says why
+    if (new_space && asteroid->isBlocked(new_space->getX(), new_space->getY()))
+    {
+        menu.formatPrompt(new_space->getDesc());
+        return false;
+    }
+
     //if space in specified direction is not out of bounds (nullptr)
     if (new_space)
     {
@@ -420,13 +974,137 @@ void Game::move(Direction direction)
         traveler->setX(new_x);
         traveler->setY(new_y);
 
-        //deduct oxygen level
-        traveler->setOxygen(traveler->getOxygen() - 1);
+        //deduct the oxygen it takes to step onto the new space
+        int cost = SPACE_CONFIG_LT[asteroid->getType(new_x, new_y)].oxygen_cost;
+        traveler->setOxygen(traveler->getOxygen() - cost);
+
+        //reveal the cells that came into view
+        if (fog)
+        {
+            fog->step(current_x, current_y, new_x, new_y);
+        }
+
+        //roaming aliens move when you do
+        if (swarm)
+        {
+            roamAliens();
+        }
+
+        //so do scheduled events
+        runEvents();
+        return true;
+    }
+
+    //it was nullptr, out of bounds
+    menu.formatPrompt(WALL_MESSAGE);
+    return false;
+}
+
+
+/********************************************************************
+** Function: roamAliens: Moves the roaming aliens one step, toward
+ *              the traveler if they hunt, and lets the ones that
+ *              reach the traveler attack.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Game::roamAliens()
+{
+    int x = traveler->getX();
+    int y = traveler->getY();
+    int attacks = 0;
+
+    if (trail)
+    {
+        //one field for every alien, updated for the traveler's step
+        trail->moveTarget(x, y);
+        attacks = swarm->hunt(*trail, x, y);
     }
     else
     {
-        //it was nullptr, out of bounds
-        menu.formatPrompt("You can't go there.");
+        attacks = swarm->step(x, y);
+    }
+
+    for (int i=0; i<attacks; i++)
+    {
+        AlienType type = swarm->getType(swarm->getAttacker(i));
+
+        //you got attacked by a roaming alien
+        menu.printBorder();
+        IOBackend::out() << endl;
+        IOBackend::out() << "A roaming " << ALIEN_DESC_LT[type].name
+             << " caught up with you!" << endl;
+        IOBackend::out() << "You lost " << AlienSwarm::DAMAGE
+             << " health points!" << endl;
+        menu.printBorder();
+
+        //deduct health points
+        traveler->setHealth(traveler->getHealth() - AlienSwarm::DAMAGE);
+    }
+}
+
+
+/********************************************************************
+** Function: runEvents: Moves the scheduled events one step forward
+ *              and carries out the ones due, such as an alien
+ *              coming back to hide, the suit leaking oxygen, or a
+ *              meteor shower.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Game::runEvents()
+{
+    int due = events.advance();
+
+    for (int i=0; i<due; i++)
+    {
+        const TimerWheel::Event &event = events.getFired(i);
+
+        switch (event.kind)
+        {
+            case ALIEN_RETURNS :
+            {
+                //the alien sneaks back into its hiding spot
+                AsteroidObject *landmark =
+                        dynamic_cast<AsteroidObject*>(asteroid->getSpace(event.x, event.y));
+                if (landmark && !landmark->hasAlien())
+                {
+                    landmark->setAlien(static_cast<AlienType>(event.value));
+                }
+                break;
+            }
+            case OXYGEN_LEAK :
+                //your suit is leaking
+                IOBackend::out() << "Your suit is leaking! You lost "
+                     << event.value << " oxygen." << endl;
+                traveler->setOxygen(traveler->getOxygen() - event.value);
+                break;
+            case METEOR_SHOWER :
+            {
+                //the ground around where it hits is blasted into craters,
+                // all changed at once
+                int x = MyRandom::randomInteger(0, COLS - 1);
+                int y = MyRandom::randomInteger(0, ROWS - 1);
+                impacts.clear();
+                impacts.convert(x - 1, y - 1, x + 1, y + 1, GROUND, CRATER);
+
+                IOBackend::out() << "A meteor shower hit the asteroid near "
+                     << x << ", " << y << "!" << endl;
+                //new craters are new spaces, so this can allocate
+                AllocCounter::pause();
+                int changed = asteroid->apply(impacts);
+                AllocCounter::resume();
+
+                if (changed > 0)
+                {
+                    IOBackend::out() << "The ground there is covered in new craters."
+                         << endl;
+                }
+                break;
+            }
+            default :
+                break;
+        }
     }
 }
 
@@ -434,7 +1112,8 @@ void Game::move(Direction direction)
 /********************************************************************
 ** Function: checkArea: Allows the character to interact with the
  *              space they are in. Calls the space's interact
- *              function. Can potentially end the game.
+ *              function. Can potentially end the game. Schedules
+ *              the return of an alien that ran away, if enabled.
 ** Params:   None
 ** Returns:  None
 *********************************************************************/
@@ -444,8 +1123,28 @@ void Game::checkArea()
     int x = traveler->getX();
     int y = traveler->getY();
 
+    Space *space = asteroid->getSpace(x, y);
+
+    //remember the alien hiding here, it runs away if it attacks
+    AsteroidObject *landmark = dynamic_cast<AsteroidObject*>(space);
+    bool had_alien = landmark && landmark->hasAlien();
+    AlienType alien = had_alien ? landmark->getAlien() : KHALEESI;
+
     //interact with the space
-    bool end_game = asteroid->getSpace(x, y)->interact(traveler);
+    bool end_game = space->interact(traveler);
+
+    //the alien comes back to hide here later
+    if (had_alien && respawn_steps > 0 && !landmark->hasAlien())
+    {
+        TimerWheel::Event comeback = {ALIEN_RETURNS, x, y, alien};
+        events.schedule(respawn_steps, comeback);
+    }
+
+    //reveal around the traveler if the space moved them, like a worm hole
+    if (fog)
+    {
+        fog->step(x, y, traveler->getX(), traveler->getY());
+    }
 
     //check if game is over
     if (end_game)
@@ -466,30 +1165,26 @@ void Game::checkInventory()
     //initialize item selection index variable
     int chosen_item_index = 0;
 
-    //initialize prompts
-    const string ITEM_TITLE = "Your Inventory: ";
-    const string ITEM_PROMPT = "What do you want to do?";
-
     //initialize limits
     const int EXIT = 0;
-    int UPPER_LIMIT = traveler->getInventory()->size();
+    int UPPER_LIMIT = traveler->getInventory()->stackCount();
 
     //print border
     menu.printBorder();
-    cout << endl;
+    IOBackend::out() << endl;
 
     //print inventory
-    cout << ITEM_TITLE << endl << endl;
+    IOBackend::out() << INVENTORY_TITLE << endl << endl;
     traveler->viewInventory();
 
     //print exit option
-    cout << "0: Exit" << endl;
+    IOBackend::out() << "0: Exit" << endl;
 
     //print border
     menu.printBorder();
 
     //get user selection
-    chosen_item_index = menu.promptForInteger(ITEM_PROMPT, EXIT, UPPER_LIMIT);
+    chosen_item_index = menu.promptForInteger(INVENTORY_PROMPT, EXIT, UPPER_LIMIT);
 
     //perform action with item if user didn't choose exit
     if (chosen_item_index != EXIT)
@@ -503,11 +1198,16 @@ void Game::checkInventory()
 /********************************************************************
 ** Function: print: Prints the current state of the board, with the
  *              character, and prints the character's current oxygen
- *              level and health points. Also prints the legend.
-** Params:   None
+ *              level, health points, and material collected toward
+ *              the objective, and how much oxygen it takes to reach
+ *              the ship if worm holes are linked. Also prints the
+ *              legend.
+** Params:   ostream &out: stream to render the screen to, such as
+ *              a MemorySink when measuring rendering.
+ *              default = the current IOBackend output.
 ** Returns:  None
 *********************************************************************/
-void Game::print()
+void Game::print(std::ostream &out)
 {
     //initialize traveler data
     int x = traveler->getX();
@@ -515,25 +1215,40 @@ void Game::print()
     char icon = traveler->getIcon();
     int health = traveler->getHealth();
     int oxygen = traveler->getOxygen();
+    int progress = traveler->getInventory()->objectiveProgress();
 
     //print border
-    menu.printBorder();
-    cout << endl;
+    menu.printBorder(out);
+    out << endl;
 
     //print title
-    cout << "Space Escape" << endl << endl;
+    out << "Space Escape" << endl << endl;
 
     //print game status
-    cout << "Health: " << health << "\tOxygen: " << oxygen << endl << endl;
+    out << "Health: " << health << "\tOxygen: " << oxygen
+        << "\tMaterial: " << progress << "/" << OBJECTIVE_TOTAL;
+    if (network)
+    {
+        int needed = network->distance(x, y, ship_x, ship_y);
+        if (needed != TravelGraph::UNREACHABLE)
+        {
+            out << "\tShip: " << needed << " oxygen away";
+        }
+    }
+    out << endl << endl;
 
     //print game board
-    cout << "Map: " << endl;
-    asteroid->print(x, y, icon);
-    cout << endl;
+    out << "Map: " << endl;
+    asteroid->print(x, y, icon, out);
+    out << endl;
 
     //print legend
-    cout << LEGEND << endl;
+    out << LEGEND << endl;
+    if (fog)
+    {
+        out << " - Unexplored = " << FogOfWar::UNKNOWN_ICON << endl;
+    }
 
     //print border
-    menu.printBorder();
+    menu.printBorder(out);
 }
@@ -23,12 +23,14 @@
 #ifndef GAME_HPP
 #define GAME_HPP
 
+#include <ctime>
 #include <iostream>
 #include <string>
 #include "Menu.hpp"
 #include "GameDefaults.hpp"
 #include "Space.hpp"
 #include "Ground.hpp"
+#include "Chasm.hpp"
 #include "Rocketship.hpp"
 #include "AsteroidObject.hpp"
 #include "Crater.hpp"
@@ -37,6 +39,18 @@
 #include "Board.hpp"
 #include "Human.hpp"
 #include "Item.hpp"
+#include "FogOfWar.hpp"
+#include "AllocCounter.hpp"
+#include "RawTerminal.hpp"
+#include "CommandBatch.hpp"
+#include "NullIO.hpp"
+#include "AlienSwarm.hpp"
+#include "TimerWheel.hpp"
+#include "SpaceFactory.hpp"
+#include "TileBatch.hpp"
+#include "MyRandom.hpp"
+#include "TravelGraph.hpp"
+#include "JumpPointSearch.hpp"
 
 class Game
 {
@@ -49,7 +63,8 @@ private:
         GO_DOWN,
         GO_LEFT,
         CHECK_SPACE,
-        CHECK_INVENTORY
+        CHECK_INVENTORY,
+        QUIT_GAME
     };
 
     enum Direction
@@ -60,18 +75,79 @@ private:
         LEFT
     };
 
+    //kinds of scheduled events
+    enum EventKind
+    {
+        ALIEN_RETURNS,
+        OXYGEN_LEAK,
+        METEOR_SHOWER
+    };
+
     //initialize constant configurations
     static const int ROWS;
     static const int COLS;
     static const int TRAVELER_START_X;
     static const int TRAVELER_START_Y;
 
+    //initialize prompts, built once so turns don't allocate them
+    static const int ACTION_CHOICES_SIZE;
+    static const std::string ACTION_CHOICES[];
+    static const std::string ACTION_PROMPT;
+    static const std::string WALL_MESSAGE;
+    static const std::string INVENTORY_TITLE;
+    static const std::string INVENTORY_PROMPT;
+    static const std::string KEY_HELP;
+    static const std::string COMMAND_HELP;
+    static const std::string COMMAND_PROMPT;
+
     //initialize player
     Human *traveler;
 
     //initialize board
     Board *asteroid;
 
+    //initialize explored set, nullptr unless fog of war is enabled
+    FogOfWar *fog;
+
+    //initialize key input, nullptr unless raw input is enabled
+    RawTerminal *terminal;
+
+    //initialize roaming aliens, nullptr unless they are enabled
+    AlienSwarm *swarm;
+
+    //initialize distances to the traveler, nullptr unless aliens hunt
+    FlowField *trail;
+
+    //initialize travel times between cells, nullptr unless worm holes
+    // are linked
+    TravelGraph *network;
+
+    //initialize shortest routes around blocked cells, for goto
+    JumpPointSearch *routes;
+
+    //initialize cells of the route being walked, reused
+    std::vector<int> route;
+
+    //initialize coordinates of the rocket ship
+    int ship_x;
+    int ship_y;
+
+    //initialize the steps of the command being run
+    CommandBatch commands;
+
+    //initialize events scheduled by step
+    TimerWheel events;
+
+    //initialize steps until a hidden alien that ran away comes back,
+    // 0 if they stay away
+    int respawn_steps;
+
+    //initialize tile changes made by a meteor shower, reused
+    TileBatch impacts;
+
+    //initialize cells worm holes can send the traveler to
+    TeleportTable destinations;
+
     //initialize game status flag
     bool game_over;
 
@@ -93,8 +169,6 @@ public:
     /********************************************************************
     ** Function: Destructor: Responsible for de-allocating all Space
      *              objects and pointing the board's pointer to nullptr.
-     *              Also responsible for checking if the Space object has
-     *              any item objects, then de-allocating those as well.
     ** Params:   None
     ** Returns:  None
     *********************************************************************/
@@ -112,12 +186,173 @@ public:
     *********************************************************************/
     void start();
 
+
+    /********************************************************************
+    ** Function: runScript: Plays the game from a script instead of the
+     *              menus. Each action in the script is one turn:
+     *              U, R, D, L move, C checks the space, and I opens the
+     *              inventory, where the numbers that follow use those
+     *              items. Letters may be upper or lower case, spaces
+     *              between them are optional, and # starts a comment
+     *              that runs to the end of the line. Prompts are
+     *              answered with yes and nothing is printed until the
+     *              script runs out or the game ends, then a summary is
+     *              printed.
+    ** Params:   istream &script: stream to read the script from.
+    ** Returns:  None
+    *********************************************************************/
+    void runScript(std::istream &script);
+
+
+    /********************************************************************
+    ** Function: enableFogOfWar: Turns on fog of war. Only the cells
+     *              within the visibility radius of where the traveler
+     *              has been are shown on the map.
+    ** Params:   int radius: how far the traveler can see.
+     *              default = FogOfWar::DEFAULT_RADIUS.
+    ** Returns:  None
+    *********************************************************************/
+    void enableFogOfWar(int radius = FogOfWar::DEFAULT_RADIUS);
+
+
+    /********************************************************************
+    ** Function: enableRawInput: Plays with single key presses instead
+     *              of the numbered action menu. W, A, S, D or the arrow
+     *              keys move, C checks the space, I opens the
+     *              inventory, and Q quits. Prompts for a whole line
+     *              still use normal line input.
+    ** Params:   None
+    ** Returns:  bool: true if input is a terminal that supports it.
+    *********************************************************************/
+    bool enableRawInput();
+
+
+    /********************************************************************
+    ** Function: enableAliens: Lets aliens roam the asteroid. They take
+     *              a random step every time the traveler moves, and
+     *              attack if they step onto the traveler. These are in
+     *              addition to the aliens hiding in craters and under
+     *              space rocks.
+    ** Params:   int count: number of roaming aliens.
+     *           unsigned int seed: seed for where they start and go.
+     *              default = time(0).
+    ** Returns:  None
+    *********************************************************************/
+    void enableAliens(int count, unsigned int seed = time(0));
+
+
+    /********************************************************************
+    ** Function: enableHunting: Makes roaming aliens hunt the traveler
+     *              instead of wandering. They all follow one flow field
+     *              that is updated as the traveler moves and as tiles
+     *              of the board change.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void enableHunting();
+
+
+    /********************************************************************
+    ** Function: enableRespawn: Makes aliens that ran away from a crater
+     *              or space rock come back and hide there again after
+     *              a number of steps.
+    ** Params:   int steps: steps until an alien comes back.
+    ** Returns:  None
+    *********************************************************************/
+    void enableRespawn(int steps);
+
+
+    /********************************************************************
+    ** Function: enableOxygenLeak: Gives the traveler's suit a leak
+     *              that loses one oxygen point every few steps, on top
+     *              of the oxygen used by moving.
+    ** Params:   int steps: steps between losing oxygen.
+    ** Returns:  None
+    *********************************************************************/
+    void enableOxygenLeak(int steps);
+
+
+    /********************************************************************
+    ** Function: enableMeteors: Makes a meteor shower hit the asteroid
+     *              every few steps, turning the ground in a 3x3 area
+     *              around a random cell into craters.
+    ** Params:   int steps: steps between meteor showers.
+    ** Returns:  None
+    *********************************************************************/
+    void enableMeteors(int steps);
+
+
+    /********************************************************************
+    ** Function: enableLinkedWormholes: Links the worm holes to each
+     *              other as listed in the level design, so each one
+     *              always leads to the same place, and works out the
+     *              travel times between every pair of cells, used to
+     *              show how far away the ship is.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void enableLinkedWormholes();
+
+
+    /********************************************************************
+    ** Function: getTravelGraph: Returns the travel times between cells,
+     *              for bots and hints.
+    ** Params:   None
+    ** Returns:  const TravelGraph *: travel times, or nullptr if worm
+     *              holes are not linked.
+    *********************************************************************/
+    const TravelGraph *getTravelGraph() const;
+
+
+    /********************************************************************
+    ** Function: setTheme: Sets the theme used to color the map.
+    ** Params:   const Theme *theme: theme to use, or nullptr to print
+     *              the map without colors.
+    ** Returns:  None
+    *********************************************************************/
+    void setTheme(const Theme *theme);
+
+
+    /********************************************************************
+    ** Function: getFogOfWar: Returns the cells the traveler has
+     *              explored so far.
+    ** Params:   None
+    ** Returns:  const FogOfWar *: explored set, or nullptr if fog of
+     *              war is not enabled.
+    *********************************************************************/
+    const FogOfWar *getFogOfWar() const;
+
+
+    /********************************************************************
+    ** Function: getBoard: Returns the game board, for tools that
+     *              inspect or export the level.
+    ** Params:   None
+    ** Returns:  const Board *: the game board.
+    *********************************************************************/
+    const Board *getBoard() const;
+
+
+    /********************************************************************
+    ** Function: print: Prints the current state of the board, with the
+     *              character, and prints the character's current oxygen
+     *              level, health points, and material collected toward
+     *              the objective, and how much oxygen it takes to reach
+     *              the ship if worm holes are linked. Also prints the
+     *              legend.
+    ** Params:   ostream &out: stream to render the screen to, such as
+     *              a MemorySink when measuring rendering.
+     *              default = the current IOBackend output.
+    ** Returns:  None
+    *********************************************************************/
+    void print(std::ostream &out = IOBackend::out());
+
 private:
 
     /********************************************************************
     ** Function: setupSpaces: Creates board instance and space objects
      *              according to level design and inserts them into the
-     *              game board.
+     *              game board. Builds the worm hole destinations, which
+     *              are built again whenever tiles change.
     ** Params:   None
     ** Returns:  None
     *********************************************************************/
@@ -144,8 +379,8 @@ private:
 
     /********************************************************************
     ** Function: setupTraveler: Creates human instance at default
-     *              location coordinates. Creates and gives the traveler
-     *              4 health packs.
+     *              location coordinates. Gives the traveler 4 health
+     *              packs.
     ** Params:   None
     ** Returns:  None
     *********************************************************************/
@@ -156,11 +391,69 @@ private:
     ** Function: playMenu: Prints a menu of actions to perform and
      *              prompts user to choose one. They can choose to go up,
      *              go right, go down, go left, check the space they are
-     *              in, or look in their inventory.
+     *              in, or look in their inventory. Instead of a number
+     *              they can type a compound command, such as "5R 3U C"
+     *              or "goto 7,2". The choice is stored in commands.
     ** Params:   None
-    ** Returns:  Action: user's selected action.
+    ** Returns:  None
     *********************************************************************/
-    Action playMenu();
+    void playMenu();
+
+
+    /********************************************************************
+    ** Function: runCommands: Runs every step of commands as one turn,
+     *              without printing the map in between. Stops early if
+     *              the traveler hits a wall or dies. Checking the space
+     *              or the inventory prompts the user, so it is always
+     *              the last step run.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void runCommands();
+
+
+    /********************************************************************
+    ** Function: walkTo: Moves the traveler one space at a time to the
+     *              specified coordinates, along the fewest steps
+     *              around anything that can't be crossed.
+    ** Params:   int x: x-coordinate to walk to.
+     *           int y: y-coordinate to walk to.
+    ** Returns:  bool: true if the traveler got there, false if there
+     *              is no way there or they died on the way.
+    *********************************************************************/
+    bool walkTo(int x, int y);
+
+
+    /********************************************************************
+    ** Function: roamAliens: Moves the roaming aliens one step, toward
+     *              the traveler if they hunt, and lets the ones that
+     *              reach the traveler attack.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void roamAliens();
+
+
+    /********************************************************************
+    ** Function: runEvents: Moves the scheduled events one step forward
+     *              and carries out the ones due, such as an alien
+     *              coming back to hide, the suit leaking oxygen, or a
+     *              meteor shower.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void runEvents();
+
+
+    /********************************************************************
+    ** Function: keyMenu: Prints the keys that can be pressed and waits
+     *              for one that maps to an action. Other keys are
+     *              ignored. Used instead of playMenu with raw input.
+    ** Params:   None
+    ** Returns:  Action: action for the key, QUIT_GAME if the input
+     *              was closed.
+    *********************************************************************/
+    Action keyMenu();
 
 
     /********************************************************************
@@ -175,19 +468,23 @@ private:
 
     /********************************************************************
     ** Function: move: Moves the character on space in specified
-     *              direction. A successful movement subtracts one oxygen
-     *              point.
+     *              direction. A successful movement subtracts the
+     *              oxygen cost of the new space's type, roaming aliens
+     *              move with it, and scheduled events move one step
+     *              forward.
     ** Params:   Direction direction: the direction in which to move the
      *              character.
-    ** Returns:  None
+    ** Returns:  bool: true if the traveler moved, false if there was
+     *              a wall or a space that can't be crossed in the way.
     *********************************************************************/
-    void move(Direction direction);
+    bool move(Direction direction);
 
 
     /********************************************************************
     ** Function: checkArea: Allows the character to interact with the
      *              space they are in. Calls the space's interact
-     *              function. Can potentially end the game.
+     *              function. Can potentially end the game. Schedules
+     *              the return of an alien that ran away, if enabled.
     ** Params:   None
     ** Returns:  None
     *********************************************************************/
@@ -203,15 +500,6 @@ private:
     void checkInventory();
 
 
-    /********************************************************************
-    ** Function: print: Prints the current state of the board, with the
-     *              character, and prints the character's current oxygen
-     *              level and health points. Also prints the legend.
-    ** Params:   None
-    ** Returns:  None
-    *********************************************************************/
-    void print();
-
 };
 
 #endif
@@ -17,18 +17,24 @@
 
 //initialize static game constants
 const int GameDefaults::ZERO = 0;
-const int GameDefaults::CONFIG_SIZE = 6;
+const int GameDefaults::CONFIG_SIZE = 7;
 const int GameDefaults::ALIEN_SIZE = 3;
 const int GameDefaults::ITEM_SIZE = 3;
 const int GameDefaults::SPACE_LOCATION_SIZE = 100;
 const int GameDefaults::ALIEN_LOCATION_SIZE = 10;
 const int GameDefaults::ITEM_LOCATION_SIZE = 10;
+const int GameDefaults::WORMHOLE_LINK_SIZE = 3;
+
+//initialize objective constants, 5 plutonium ore and 5 ship parts
+const int GameDefaults::REQUIRED_MATERIAL = 5;
+const int GameDefaults::OBJECTIVE_TOTAL = 2 * GameDefaults::REQUIRED_MATERIAL;
 
 //initialize extern alias to lookup tables
 const GameDefaults::SpaceConfig *SPACE_CONFIG_LT = GameDefaults::SPACE_CONFIG;
 const GameDefaults::AlienInfo *ALIEN_DESC_LT = GameDefaults::ALIEN_DESC;
 const GameDefaults::ItemInfo *ITEM_DESC_LT = GameDefaults::ITEM_DESC;
 const GameDefaults::SpaceMap *SPACE_LOCATIONS_LT = GameDefaults::SPACE_LOCATIONS;
+const GameDefaults::WormholeLink *WORMHOLE_LINKS_LT = GameDefaults::WORMHOLE_LINKS;
 const GameDefaults::AlienMap *ALIEN_LOCATIONS_LT = GameDefaults::ALIEN_LOCATIONS;
 const GameDefaults::ItemMap *ITEM_LOCATIONS_LT = GameDefaults::ITEM_LOCATIONS;
 
@@ -52,7 +58,8 @@ const std::string GameDefaults::OBJECTIVE =
 //initialize game time limit
 const std::string GameDefaults::TIME_LIMIT =
         "TIME LIMIT:\nYou are low on oxygen. You can only take 100 steps before "
-        "you run out and suffocated in the coldness of space. You also start "
+        "you run out and suffocated in the coldness of space, and climbing into "
+        "a crater takes as much oxygen as 2 steps. You also start "
         "with 100 health points. You only have 4 health packs left that will "
         "recover 10 health points each. If you run out of health, you will die.";
 
@@ -63,7 +70,8 @@ const std::string GameDefaults::LEGEND =
         " - Rocket ship = ^\n"
         " - Craters = O\n"
         " - Space rocks = #\n"
-        " - Worm holes = @";
+        " - Worm holes = @\n"
+        " - Chasms = %";
 
 //initialize title art
 const std::string GameDefaults::TITLE_ART =
@@ -131,6 +139,10 @@ const std::string LEGEND = GameDefaults::LEGEND;
 const std::string TITLE_ART = GameDefaults::TITLE_ART;
 const std::string BLAST_OFF_ART = GameDefaults::BLAST_OFF_ART;
 
+//initialize extern aliases to objective constants
+const int REQUIRED_MATERIAL = GameDefaults::REQUIRED_MATERIAL;
+const int OBJECTIVE_TOTAL = GameDefaults::OBJECTIVE_TOTAL;
+
 
 //initialize lookup tables
 const GameDefaults::SpaceConfig GameDefaults::SPACE_CONFIG[GameDefaults::CONFIG_SIZE] =
@@ -139,20 +151,23 @@ const GameDefaults::SpaceConfig GameDefaults::SPACE_CONFIG[GameDefaults::CONFIG_
           "cone-shaped contraption that your father bought for your "
           "18th birthday. It has 4 rocket engines, a kitchen, dry bath, sleep "
           "compartment, and warp drive capable of travelling millions of light-years "
-          "in the blink of an eye. It is powered by plutonium ore."}, //rocketship defaults
+          "in the blink of an eye. It is powered by plutonium ore.", 1, true}, //rocketship defaults
          {0, 0, 'O', CRATER,
           "A large, bowl-shaped hole on the surface of the asteroid. You can "
-          "jump in if you want."}, //crater defaults
+          "jump in if you want.", 2, true}, //crater defaults, climbing the rim takes extra oxygen
          {0, 0, '#', SPACEROCK,
           "A medium-sized boulder on the surface of the asteroid. You can lift it up "
-          "to check what's under it."}, //spacerock defaults
+          "to check what's under it.", 1, true}, //spacerock defaults
          {0, 0, '@', WORMHOLE,
           "A physical anomaly that is a rift in the fabric of time and space. "
-          "You can walk through the worm hole if you want."}, //wormhole defaults
+          "You can walk through the worm hole if you want.", 1, true}, //wormhole defaults
          {0, 0, '_', GROUND,
           "The ground is dusty, and the gray dirt feels like a silky powder. "
-          "There is nothing on the ground."}, //ground defaults
-         {0, 0, '_', GROUND, ""}}; //default space
+          "There is nothing on the ground.", 1, true}, //ground defaults
+         {0, 0, '%', CHASM,
+          "A deep crack in the surface of the asteroid. You can't see the "
+          "bottom, and it is too wide to jump across.", 1, false}, //chasm defaults, can't be crossed
+         {0, 0, '_', GROUND, "", 1, false}}; //default space
 
 const GameDefaults::AlienInfo GameDefaults::ALIEN_DESC[GameDefaults::ALIEN_SIZE] =
         {{"PCMustard",
@@ -291,6 +306,12 @@ const GameDefaults::SpaceMap GameDefaults::SPACE_LOCATIONS[GameDefaults::SPACE_L
          {8, 9, GROUND},
          {9, 9, GROUND}};
 
+//worm holes that lead to each other when linked, one way each
+const GameDefaults::WormholeLink GameDefaults::WORMHOLE_LINKS[GameDefaults::WORMHOLE_LINK_SIZE] =
+        {{5, 2, 2, 6},
+         {2, 6, 7, 8},
+         {7, 8, 5, 2}};
+
 //hidden aliens
 const GameDefaults::AlienMap GameDefaults::ALIEN_LOCATIONS[GameDefaults::ALIEN_LOCATION_SIZE] =
         {{1, 0, PCMUSTARD},
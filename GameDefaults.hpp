@@ -29,6 +29,11 @@ public:
     static const int SPACE_LOCATION_SIZE;
     static const int ALIEN_LOCATION_SIZE;
     static const int ITEM_LOCATION_SIZE;
+    static const int WORMHOLE_LINK_SIZE;
+
+    //initialize objective constants
+    static const int REQUIRED_MATERIAL;
+    static const int OBJECTIVE_TOTAL;
 
     //enums for asset types
     enum SpaceType
@@ -38,6 +43,7 @@ public:
         SPACEROCK,
         WORMHOLE,
         GROUND,
+        CHASM,
         DEFAULTSPACE
     };
 
@@ -63,6 +69,10 @@ public:
         char icon_default;
         SpaceType type_default;
         std::string description_default;
+        //oxygen used to step onto a space of this type
+        int oxygen_cost;
+        //false if nothing can step onto a space of this type
+        bool passable;
     };
 
     struct AlienInfo
@@ -84,6 +94,14 @@ public:
         SpaceType type;
     };
 
+    struct WormholeLink
+    {
+        int from_x;
+        int from_y;
+        int to_x;
+        int to_y;
+    };
+
     struct AlienMap
     {
         int x;
@@ -104,6 +122,7 @@ public:
     static const AlienInfo ALIEN_DESC[];
     static const ItemInfo ITEM_DESC[];
     static const SpaceMap SPACE_LOCATIONS[];
+    static const WormholeLink WORMHOLE_LINKS[];
     static const AlienMap ALIEN_LOCATIONS[];
     static const ItemMap ITEM_LOCATIONS[];
 
@@ -138,6 +157,7 @@ extern const GameDefaults::SpaceConfig  *SPACE_CONFIG_LT;
 extern const GameDefaults::AlienInfo    *ALIEN_DESC_LT;
 extern const GameDefaults::ItemInfo     *ITEM_DESC_LT;
 extern const GameDefaults::SpaceMap     *SPACE_LOCATIONS_LT;
+extern const GameDefaults::WormholeLink *WORMHOLE_LINKS_LT;
 extern const GameDefaults::AlienMap     *ALIEN_LOCATIONS_LT;
 extern const GameDefaults::ItemMap      *ITEM_LOCATIONS_LT;
 
@@ -147,6 +167,7 @@ const SpaceType CRATER = GameDefaults::CRATER;
 const SpaceType SPACEROCK = GameDefaults::SPACEROCK;
 const SpaceType WORMHOLE = GameDefaults::WORMHOLE;
 const SpaceType GROUND = GameDefaults::GROUND;
+const SpaceType CHASM = GameDefaults::CHASM;
 const SpaceType DEFAULTSPACE = GameDefaults::DEFAULTSPACE;
 
 //Alias to AlienType enums
@@ -159,6 +180,11 @@ const ItemType HEALTHPACK = GameDefaults::HEALTHPACK;
 const ItemType PLUTONIUMORE = GameDefaults::PLUTONIUMORE;
 const ItemType SHIPPART = GameDefaults::SHIPPART;
 
+//Alias for pieces of each material needed to fix the ship
+extern const int REQUIRED_MATERIAL;
+//Alias for total pieces of material needed to fix the ship
+extern const int OBJECTIVE_TOTAL;
+
 //Alias for game description
 extern const std::string STORY;
 //Alias for game objective
@@ -14,7 +14,6 @@
 
 #include "Ground.hpp"
 
-using std::cout;
 using std::endl;
 using std::string;
 
@@ -19,11 +19,13 @@
 
 #include "Human.hpp"
 
-using std::cout;
-using std::cin;
 using std::endl;
 using std::string;
 
+//initialize static human constants
+const char Human::DEFAULT_ICON = '&';
+const string Human::USE_HEALTH_PACK_PROMPT = "Do you want to use the health pack?";
+
 /********************************************************************
 ** Function: Constructor/default: Creates a default human instance
  *              and initializes data members.
@@ -36,7 +38,7 @@ using std::string;
  *           int oxygen: oxygen level of human.
  *              default = 100.
  *           char icon: character representation of human.
- *              default = '&'.
+ *              default = DEFAULT_ICON ('&').
 ** Returns:  None
 *********************************************************************/
 Human::Human(int x, int y, int health, int oxygen, char icon)
@@ -171,13 +173,13 @@ void Human::viewInventory() const
  *              plutonium ore, it will read the description. If the
  *              item is a health pack, it will read the description
  *              then ask if you want to use the health pack.
-** Params:   int item_index: index of the item in your inventory.
+** Params:   int item_index: index of the item's stack in your inventory.
 ** Returns:  None
 *********************************************************************/
 void Human::selectItem(int item_index)
 {
     //find item
-    Item *selected_item = backpack.find(item_index);
+    const Item *selected_item = backpack.find(item_index);
 
     if (selected_item)
     {
@@ -187,9 +189,6 @@ void Human::selectItem(int item_index)
         //if item is a health pack, ask if use wants to use it
         if (selected_item->getType() == HEALTHPACK)
         {
-            const string USE_HEALTH_PACK_PROMPT =
-                    "Do you want to use the health pack?";
-
             //if user wants to use it
             if (menu.confirm(USE_HEALTH_PACK_PROMPT) == Menu::YES)
             {
@@ -199,29 +198,25 @@ void Human::selectItem(int item_index)
     }
     else
     {
-        cout << "Error: item not found" << endl;
+        IOBackend::out() << "Error: item not found" << endl;
     }
 }
 
 
 /********************************************************************
 ** Function: addInventory: Adds an item to your inventory.
-** Params:   Item * treasure: Item to add to your inventory.
+** Params:   Item treasure: Item to add to your inventory.
 ** Returns:  None
 *********************************************************************/
-void Human::addInventory(Item *treasure)
+void Human::addInventory(Item treasure)
 {
-    if (treasure)
-    {
-        backpack.push(treasure);
-    }
+    backpack.push(treasure);
 }
 
 
 /********************************************************************
 ** Function: useHealthPack: Adds 10 points to your health then
- *              removes the health pack from your inventory and
- *              deletes it.
+ *              removes the health pack from your inventory.
 ** Params:   None
 ** Returns:  None
 *********************************************************************/
@@ -231,11 +226,12 @@ void Human::useHealthPack()
     const int RESTORE_POINTS = 10;
     setHealth(getHealth() + RESTORE_POINTS);
 
-    //print that you restored 10 health points
-    menu.formatPrompt
-    ("You recovered " + std::to_string(RESTORE_POINTS) + " health points.");
+    //print that you restored 10 health points, formatted like a prompt
+    menu.printBorder();
+    IOBackend::out() << endl;
+    IOBackend::out() << "You recovered " << RESTORE_POINTS << " health points." << endl;
+    menu.printBorder();
 
-    //remove health pack from inventory and delete it,
-    // health packs are at the front of the inventory.
-    backpack.pop();
+    //remove one health pack from its stack
+    backpack.remove(HEALTHPACK);
 }
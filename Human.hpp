@@ -29,7 +29,14 @@
 
 class Human
 {
+public:
+    //icon used to draw a human on the map
+    static const char DEFAULT_ICON;
+
 private:
+    //prompt asking to use a health pack
+    static const std::string USE_HEALTH_PACK_PROMPT;
+
     int x_coord;
     int y_coord;
     int health;
@@ -52,10 +59,11 @@ public:
      *           int oxygen: oxygen level of human.
      *              default = 100.
      *           char icon: character representation of human.
-     *              default = '&'.
+     *              default = DEFAULT_ICON ('&').
     ** Returns:  None
     *********************************************************************/
-    Human(int x = 0, int y = 0, int health = 100, int oxygen = 100, char icon = '&');
+    Human(int x = 0, int y = 0, int health = 100, int oxygen = 100,
+            char icon = DEFAULT_ICON);
 
 
     /********************************************************************
@@ -152,7 +160,7 @@ public:
      *              plutonium ore, it will read the description. If the
      *              item is a health pack, it will read the description
      *              then ask if you want to use the health pack.
-    ** Params:   int item_index: index of the item in your inventory.
+    ** Params:   int item_index: index of the item's stack in your inventory.
     ** Returns:  None
     *********************************************************************/
     void selectItem(int item_index);
@@ -160,16 +168,15 @@ public:
 
     /********************************************************************
     ** Function: addInventory: Adds an item to your inventory.
-    ** Params:   Item * treasure: Item to add to your inventory.
+    ** Params:   Item treasure: Item to add to your inventory.
     ** Returns:  None
     *********************************************************************/
-    void addInventory(Item *treasure);
+    void addInventory(Item treasure);
 
 
     /********************************************************************
     ** Function: useHealthPack: Adds 10 points to your health then
-     *              removes the health pack from your inventory and
-     *              deletes it.
+     *              removes the health pack from your inventory.
     ** Params:   None
     ** Returns:  None
     *********************************************************************/
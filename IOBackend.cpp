@@ -0,0 +1,97 @@
+/*********************************************************************
+** Program name: IOBackend.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 20, 2019 at 2:45 PM
+** Description: Class implementation file for IOBackend. IOBackend is
+ *              the interface the game reads input from and prints
+ *              output to, instead of using cin and cout directly.
+ *              Subclasses provide the streams: ConsoleIO for the
+ *              terminal, MemoryIO for in-memory buffers, FdIO for
+ *              file descriptors and sockets, and NullIO to discard
+ *              everything. One backend is current at a time, and
+ *              Menu, ValidateInput, and the rest of the game use the
+ *              current backend through the static in() and out().
+ *              The console is current until another is set.
+*********************************************************************/
+
+
+#include "IOBackend.hpp"
+#include "ConsoleIO.hpp"
+
+//initialize current backend, the console until one is set
+IOBackend *IOBackend::active = nullptr;
+
+/********************************************************************
+** Function: Destructor: Virtual so backends can be deleted through
+ *              an IOBackend pointer.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+IOBackend::~IOBackend()
+{}
+
+
+/********************************************************************
+** Function: console: Returns the console backend used when no
+ *              other backend is set.
+** Params:   None
+** Returns:  IOBackend &: the console backend.
+*********************************************************************/
+IOBackend &IOBackend::console()
+{
+    static ConsoleIO terminal;
+    return terminal;
+}
+
+
+/********************************************************************
+** Function: setCurrent: Makes a backend current. The backend must
+ *              stay alive until another one is set.
+** Params:   IOBackend *backend: backend to use, or nullptr to use
+ *              the console.
+** Returns:  IOBackend *: the backend that was current before, or
+ *              nullptr if it was the console, so it can be put
+ *              back later.
+*********************************************************************/
+IOBackend *IOBackend::setCurrent(IOBackend *backend)
+{
+    //flush anything still buffered for the old backend
+    current().output().flush();
+
+    IOBackend *previous = active;
+    active = backend;
+    return previous;
+}
+
+
+/********************************************************************
+** Function: current: Returns the current backend.
+** Params:   None
+** Returns:  IOBackend &: the current backend.
+*********************************************************************/
+IOBackend &IOBackend::current()
+{
+    return active ? *active : console();
+}
+
+
+/********************************************************************
+** Function: in: Returns the input stream of the current backend.
+** Params:   None
+** Returns:  istream &: current input stream.
+*********************************************************************/
+std::istream &IOBackend::in()
+{
+    return current().input();
+}
+
+
+/********************************************************************
+** Function: out: Returns the output stream of the current backend.
+** Params:   None
+** Returns:  ostream &: current output stream.
+*********************************************************************/
+std::ostream &IOBackend::out()
+{
+    return current().output();
+}
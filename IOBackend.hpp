@@ -0,0 +1,101 @@
+/*********************************************************************
+** Program name: IOBackend.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 20, 2019 at 2:45 PM
+** Description: Class specification file for IOBackend. IOBackend is
+ *              the interface the game reads input from and prints
+ *              output to, instead of using cin and cout directly.
+ *              Subclasses provide the streams: ConsoleIO for the
+ *              terminal, MemoryIO for in-memory buffers, FdIO for
+ *              file descriptors and sockets, and NullIO to discard
+ *              everything. One backend is current at a time, and
+ *              Menu, ValidateInput, and the rest of the game use the
+ *              current backend through the static in() and out().
+ *              The console is current until another is set.
+*********************************************************************/
+
+
+#ifndef IO_BACKEND_HPP
+#define IO_BACKEND_HPP
+
+#include <iostream>
+
+class IOBackend
+{
+private:
+    //backend in use, nullptr means the console
+    static IOBackend *active;
+
+    /********************************************************************
+    ** Function: console: Returns the console backend used when no
+     *              other backend is set.
+    ** Params:   None
+    ** Returns:  IOBackend &: the console backend.
+    *********************************************************************/
+    static IOBackend &console();
+
+public:
+
+    /********************************************************************
+    ** Function: Destructor: Virtual so backends can be deleted through
+     *              an IOBackend pointer.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    virtual ~IOBackend();
+
+
+    /********************************************************************
+    ** Function: input: Returns the stream to read input from.
+    ** Params:   None
+    ** Returns:  istream &: input stream of this backend.
+    *********************************************************************/
+    virtual std::istream &input() = 0;
+
+
+    /********************************************************************
+    ** Function: output: Returns the stream to print output to.
+    ** Params:   None
+    ** Returns:  ostream &: output stream of this backend.
+    *********************************************************************/
+    virtual std::ostream &output() = 0;
+
+
+    /********************************************************************
+    ** Function: setCurrent: Makes a backend current. The backend must
+     *              stay alive until another one is set.
+    ** Params:   IOBackend *backend: backend to use, or nullptr to use
+     *              the console.
+    ** Returns:  IOBackend *: the backend that was current before, or
+     *              nullptr if it was the console, so it can be put
+     *              back later.
+    *********************************************************************/
+    static IOBackend *setCurrent(IOBackend *backend);
+
+
+    /********************************************************************
+    ** Function: current: Returns the current backend.
+    ** Params:   None
+    ** Returns:  IOBackend &: the current backend.
+    *********************************************************************/
+    static IOBackend &current();
+
+
+    /********************************************************************
+    ** Function: in: Returns the input stream of the current backend.
+    ** Params:   None
+    ** Returns:  istream &: current input stream.
+    *********************************************************************/
+    static std::istream &in();
+
+
+    /********************************************************************
+    ** Function: out: Returns the output stream of the current backend.
+    ** Params:   None
+    ** Returns:  ostream &: current output stream.
+    *********************************************************************/
+    static std::ostream &out();
+
+};
+
+#endif
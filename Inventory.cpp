@@ -4,125 +4,130 @@
 ** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
 ** Date: Jun 07, 2019 at 10:32 PM
 ** Description: Class implementation file for Inventory. Inventory is
- *              a container, implemented as a linked-list structured
- *              in a queue container adapter pattern. It is used by
- *              your character to carry items (pointers to items) in
- *              the Space Escape game. An inventory's maximum
- *              capacity is 15.
+ *              a container that stacks items by type, keeping one
+ *              stack per ItemType with a quantity. Stacks are listed
+ *              in the order their first item was picked up. It is used
+ *              by your character to carry items in the Space Escape
+ *              game. An inventory's maximum capacity is 15 items.
+ *              Adding, removing, finding a stack by index, and
+ *              counting items of a type take constant time and never
+ *              allocate memory.
 *********************************************************************/
 
 
 #include "Inventory.hpp"
 
-using std::cout;
 using std::endl;
 
 /********************************************************************
-** Function: Constructor/default: Creates an Inventory object, sets
- *              LIMIT, and sets head to nullptr.
+** Function: Constructor/default: Creates an empty Inventory.
 ** Params:   None
 ** Returns:  None
 *********************************************************************/
-Inventory::Inventory() : LIMIT(15), head(nullptr)
-{}
-
-
-/********************************************************************
-** Function: Destructor: Deletes all nodes in the Inventory
- *              linked-list, and the item that the node contains.
-** Params:   None
-** Returns:  None
-*********************************************************************/
-Inventory::~Inventory()
+Inventory::Inventory() : stack_count(0), item_count(0), objective_count(0)
 {
-    while (!empty())
+    for (int i=0; i<TYPE_COUNT; i++)
     {
-        //remove and delete the node and the item pointer
-        pop();
+        stack_index[i] = 0;
+        quantities[i] = 0;
     }
 }
 
 
 /********************************************************************
-** Function: push: Adds a node to the back of the linked-list queue.
- *              Checks if queue is already at capacity before adding
- *              to queue.
-** Params:   Item *value: Pointer to item object to add to queue.
+** Function: push: Adds an item to the stack of its type, starting
+ *              a new stack if you don't have any yet. Checks if the
+ *              inventory is already at capacity before adding.
+** Params:   Item value: item to add.
 ** Returns:  None
 *********************************************************************/
-void Inventory::push(Item *value)
+void Inventory::push(Item value)
 {
-    //add to inventory queue if it is not at capacity
-    if (size() < LIMIT)
+    //add to inventory if it is not at capacity
+    if (item_count < CAPACITY)
     {
-        if (empty())
+        ItemType type = value.getType();
+
+        //first item of its type starts a new stack at the end
+        if (quantities[type] == 0)
         {
-            //if list is empty add it to the head
-            head = new InventoryNode(value);
+            stacks[stack_count] = value;
+            stack_count++;
+            stack_index[type] = stack_count;
         }
-        else
+
+        //material only counts toward the objective up to the required amount
+        if (type != HEALTHPACK && quantities[type] < REQUIRED_MATERIAL)
         {
-            //if list is not empty, add it to the back of the queue
-            InventoryNode *cursor = head;
-            while (cursor->next)
-            {
-                cursor = cursor->next;
-            }
-            cursor->next = new InventoryNode(value);
+            objective_count++;
         }
+
+        quantities[type]++;
+        item_count++;
     }
     else
     {
-        cout << "Your inventory is full!" << endl;
+        IOBackend::out() << "Your inventory is full!" << endl;
     }
 }
 
 
 /********************************************************************
-** Function: pop: Deletes item pointer contained in the front node,
- *              then removes and deletes the front node.
-** Params:   None
-** Returns:  None
+** Function: remove: Removes one item of a type. The stack goes
+ *              away when its last item is removed.
+** Params:   ItemType type: type of item to remove.
+** Returns:  bool: True if an item was removed, false if you don't
+ *              have any of that type.
 *********************************************************************/
-void Inventory::pop()
+bool Inventory::remove(ItemType type)
 {
-    //delete the item pointer
-    delete head->val;
+    if (quantities[type] == 0)
+    {
+        return false;
+    }
 
-    //remove the first node and point head to the next node
-    InventoryNode *garbage = head;
-    head = head->next;
-    delete garbage;
+    quantities[type]--;
+    item_count--;
+    if (type != HEALTHPACK && quantities[type] < REQUIRED_MATERIAL)
+    {
+        objective_count--;
+    }
+
+    //last one of its type, close the gap in the stack list
+    if (quantities[type] == 0)
+    {
+        for (int i=stack_index[type]; i<stack_count; i++)
+        {
+            stacks[i - 1] = stacks[i];
+            stack_index[stacks[i - 1].getType()] = i;
+        }
+
+        stack_count--;
+        stack_index[type] = 0;
+    }
+
+    return true;
 }
 
 
 /********************************************************************
 ** Function: find: Searches your inventory and returns a pointer to
- *              the item. If not found, returns nullptr.
-** Params:   int index: 1-based index of the items in the linked-list
- *              queue.
-** Returns:  Item *: pointer to item at specified index of the queue.
+ *              an item of the stack. If not found, returns nullptr.
+ *              The pointer is only valid until the inventory
+ *              changes.
+** Params:   int index: 1-based index of the stack.
+** Returns:  const Item *: pointer to the item of the stack at the
+ *              specified index.
 *********************************************************************/
-Item *Inventory::find(int index)
+const Item *Inventory::find(int index) const
 {
-    if (!empty())
+    //return the stack at specified index if there is one
+    if (index >= 1 && index <= stack_count)
     {
-        int counter = 1;
-        InventoryNode *cursor = head;
-
-        //traverse the queue and return the item at specified index
-        while (cursor)
-        {
-            if (counter == index)
-            {
-                return cursor->val;
-            }
-            counter++;
-            cursor = cursor->next;
-        }
+        return &stacks[index - 1];
     }
 
-    //wasn't found or the queue is empty, return nullptr
+    //wasn't found or the inventory is empty, return nullptr
     return nullptr;
 }
 
@@ -135,107 +140,90 @@ Item *Inventory::find(int index)
 *********************************************************************/
 int Inventory::count(ItemType type) const
 {
-    //initialize counter
-    int counter = 0;
-
-    //check queue if it is not empty
-    if (!empty())
-    {
-        InventoryNode *cursor = head;
+    return quantities[type];
+}
 
-        //iterate through the queue to count the item
-        while (cursor)
-        {
-            //if this item is the target item,
-            // increment the count of the item by 1
-            if (cursor->val->getType() == type)
-            {
-                counter++;
-            }
-
-            //move down the queue
-            cursor = cursor->next;
-        }
-    }
 
-    //return the count
-    return counter;
+/********************************************************************
+** Function: objectiveProgress: Returns how many pieces of plutonium
+ *              ore and ship parts count toward fixing the ship.
+ *              Pieces past the required amount of a type aren't
+ *              counted.
+** Params:   None
+** Returns:  int: material collected, out of OBJECTIVE_TOTAL.
+*********************************************************************/
+int Inventory::objectiveProgress() const
+{
+    return objective_count;
 }
 
 
 /********************************************************************
-** Function: size: Iterates through the inventory linked-list and
- *              returns a count of how many nodes are present.
+** Function: objectiveComplete: Checks if you have all the material
+ *              needed to fix the ship.
 ** Params:   None
-** Returns:  int: size of inventory queue.
+** Returns:  bool: True if the objective is complete.
 *********************************************************************/
-int Inventory::size() const
+bool Inventory::objectiveComplete() const
 {
-    //initialize counter
-    int counter = 0;
+    return objective_count == OBJECTIVE_TOTAL;
+}
 
-    //if queue is not empty, proceed to count the nodes
-    if (!empty())
-    {
-        InventoryNode *cursor = head;
 
-        //iterate through the queue and count the nodes
-        while (cursor)
-        {
-            //valid node, increment counter
-            counter++;
+/********************************************************************
+** Function: size: Returns how many items are in the inventory.
+** Params:   None
+** Returns:  int: number of items.
+*********************************************************************/
+int Inventory::size() const
+{
+    return item_count;
+}
 
-            //move down the queue
-            cursor = cursor->next;
-        }
-    }
 
-    //return the counter
-    return counter;
+/********************************************************************
+** Function: stackCount: Returns how many stacks are in the
+ *              inventory, which is the highest index find accepts.
+** Params:   None
+** Returns:  int: number of stacks.
+*********************************************************************/
+int Inventory::stackCount() const
+{
+    return stack_count;
 }
 
 
 /********************************************************************
-** Function: empty: Checks if the queue is empty.
+** Function: empty: Checks if the inventory is empty.
 ** Params:   None
-** Returns:  bool: True if queue is empty, false otherwise.
+** Returns:  bool: True if inventory is empty, false otherwise.
 *********************************************************************/
 bool Inventory::empty() const
 {
-    return head == nullptr;
+    return item_count == 0;
 }
 
 
 /********************************************************************
-** Function: print: Iterates through the queue, and prints each
- *              item's name and index.
+** Function: print: Prints one line for each stack with its index,
+ *              the item's name, and the quantity.
 ** Params:   None
 ** Returns:  None
 *********************************************************************/
 void Inventory::print() const
 {
-    //if queue is not empty, print the items in the queue
+    //if inventory is not empty, print the stacks
     if (!empty())
     {
-        //initialize index of item
-        int index = 0;
-        InventoryNode *cursor = head;
-
-        //iterate through the queue and print the index and item names
-        while (cursor)
+        //print the index, item name, and quantity of each stack
+        for (int i=0; i<stack_count; i++)
         {
-            //increment and print the index
-            cout << ++index << ": ";
-
-            //print the item's name
-            cout << cursor->val->getName() << endl;
-
-            //move down the queue
-            cursor = cursor->next;
+            IOBackend::out() << (i + 1) << ": " << stacks[i].getName()
+                 << " x" << static_cast<int>(quantities[stacks[i].getType()]) << endl;
         }
     }
     else
     {
-        cout << "Your inventory is empty!" << endl;
+        IOBackend::out() << "Your inventory is empty!" << endl;
     }
 }
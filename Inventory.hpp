@@ -4,11 +4,14 @@
 ** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
 ** Date: Jun 07, 2019 at 10:32 PM
 ** Description: Class specification file for Inventory. Inventory is
- *              a container, implemented as a linked-list structured
- *              in a queue container adapter pattern. It is used by
- *              your character to carry items (pointers to items) in
- *              the Space Escape game. An inventory's maximum
- *              capacity is 15.
+ *              a container that stacks items by type, keeping one
+ *              stack per ItemType with a quantity. Stacks are listed
+ *              in the order their first item was picked up. It is used
+ *              by your character to carry items in the Space Escape
+ *              game. An inventory's maximum capacity is 15 items.
+ *              Adding, removing, finding a stack by index, and
+ *              counting items of a type take constant time and never
+ *              allocate memory.
 *********************************************************************/
 
 
@@ -17,30 +20,30 @@
 
 #include <iostream>
 #include "Item.hpp"
+#include "IOBackend.hpp"
 
 class Inventory
 {
 private:
-    //node for linked-list
-    struct InventoryNode
-    {
-        Item *val;
-        InventoryNode *next;
+    //maximum number of items, and number of item types
+    enum {CAPACITY = 15, TYPE_COUNT = GameDefaults::SHIPPART + 1};
 
-        //node constructor
-        InventoryNode(Item *val = nullptr, InventoryNode *next = nullptr)
-                    : val(val), next(next)
-        {}
-    };
+    //one item per stack in pickup order, and the stack index of each
+    // type, 0 if you have none of that type
+    Item stacks[TYPE_COUNT];
+    unsigned char stack_index[TYPE_COUNT];
+    unsigned char stack_count;
 
-    const int LIMIT;
-    InventoryNode *head;
+    //number of items of each type, total items, and material counted
+    // toward the objective
+    unsigned char quantities[TYPE_COUNT];
+    unsigned char item_count;
+    unsigned char objective_count;
 
 public:
 
     /********************************************************************
-    ** Function: Constructor/default: Creates an Inventory object, sets
-     *              LIMIT, and sets head to nullptr.
+    ** Function: Constructor/default: Creates an empty Inventory.
     ** Params:   None
     ** Returns:  None
     *********************************************************************/
@@ -48,41 +51,35 @@ public:
 
 
     /********************************************************************
-    ** Function: Destructor: Deletes all nodes in the Inventory
-     *              linked-list, and the item that the node contains.
-    ** Params:   None
-    ** Returns:  None
-    *********************************************************************/
-    ~Inventory();
-
-
-    /********************************************************************
-    ** Function: push: Adds a node to the back of the linked-list queue.
-     *              Checks if queue is already at capacity before adding
-     *              to queue.
-    ** Params:   Item *value: Pointer to item object to add to queue.
+    ** Function: push: Adds an item to the stack of its type, starting
+     *              a new stack if you don't have any yet. Checks if the
+     *              inventory is already at capacity before adding.
+    ** Params:   Item value: item to add.
     ** Returns:  None
     *********************************************************************/
-    void push(Item *value);
+    void push(Item value);
 
 
     /********************************************************************
-    ** Function: pop: Deletes item pointer contained in the front node,
-     *              then removes and deletes the front node.
-    ** Params:   None
-    ** Returns:  None
+    ** Function: remove: Removes one item of a type. The stack goes
+     *              away when its last item is removed.
+    ** Params:   ItemType type: type of item to remove.
+    ** Returns:  bool: True if an item was removed, false if you don't
+     *              have any of that type.
     *********************************************************************/
-    void pop();
+    bool remove(ItemType type);
 
 
     /********************************************************************
     ** Function: find: Searches your inventory and returns a pointer to
-     *              the item. If not found, returns nullptr.
-    ** Params:   int index: 1-based index of the items in the linked-list
-     *              queue. 
-    ** Returns:  Item *: pointer to item at specified index of the queue.
+     *              an item of the stack. If not found, returns nullptr.
+     *              The pointer is only valid until the inventory
+     *              changes.
+    ** Params:   int index: 1-based index of the stack.
+    ** Returns:  const Item *: pointer to the item of the stack at the
+     *              specified index.
     *********************************************************************/
-    Item *find(int index);
+    const Item *find(int index) const;
     
     
     /********************************************************************
@@ -95,25 +92,53 @@ public:
 
 
     /********************************************************************
-    ** Function: size: Iterates through the inventory linked-list and
-     *              returns a count of how many nodes are present.
+    ** Function: objectiveProgress: Returns how many pieces of plutonium
+     *              ore and ship parts count toward fixing the ship.
+     *              Pieces past the required amount of a type aren't
+     *              counted.
     ** Params:   None
-    ** Returns:  int: size of inventory queue.
+    ** Returns:  int: material collected, out of OBJECTIVE_TOTAL.
+    *********************************************************************/
+    int objectiveProgress() const;
+
+
+    /********************************************************************
+    ** Function: objectiveComplete: Checks if you have all the material
+     *              needed to fix the ship.
+    ** Params:   None
+    ** Returns:  bool: True if the objective is complete.
+    *********************************************************************/
+    bool objectiveComplete() const;
+
+
+    /********************************************************************
+    ** Function: size: Returns how many items are in the inventory.
+    ** Params:   None
+    ** Returns:  int: number of items.
     *********************************************************************/
     int size() const;
+
+
+    /********************************************************************
+    ** Function: stackCount: Returns how many stacks are in the
+     *              inventory, which is the highest index find accepts.
+    ** Params:   None
+    ** Returns:  int: number of stacks.
+    *********************************************************************/
+    int stackCount() const;
     
     
     /********************************************************************
-    ** Function: empty: Checks if the queue is empty.
+    ** Function: empty: Checks if the inventory is empty.
     ** Params:   None
-    ** Returns:  bool: True if queue is empty, false otherwise.
+    ** Returns:  bool: True if inventory is empty, false otherwise.
     *********************************************************************/
     bool empty() const;
 
 
     /********************************************************************
-    ** Function: print: Iterates through the queue, and prints each
-     *              item's name and index.
+    ** Function: print: Prints one line for each stack with its index,
+     *              the item's name, and the quantity.
     ** Params:   None
     ** Returns:  None
     *********************************************************************/
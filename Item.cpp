@@ -5,7 +5,10 @@
 ** Date: Jun 07, 2019 at 10:04 PM
 ** Description: Class implementation file for Item. Item represents
  *              objects/resources that you can use to aid you in your
- *              journey in the Space Escape game.
+ *              journey in the Space Escape game. All items of a type
+ *              are the same, so an item only stores its type and
+ *              looks up its name and description in the shared item
+ *              table. Items are small and are passed by value.
 *********************************************************************/
 
 
@@ -14,18 +17,12 @@
 using std::string;
 
 /********************************************************************
-** Function: Constructor/default: Creates an item instance and sets
- *              its traits.
+** Function: Constructor/default: Creates an item of a type.
 ** Params:   ItemType type: type of item.
  *              default = HEALTHPACK.
- *           string name: name of item.
- *              default = "".
- *           string description: description of item.
- *              default = "".
 ** Returns:  None
 *********************************************************************/
-Item::Item(ItemType type, string name, string description)
-        : type(type), name(name), description(description)
+Item::Item(ItemType type) : type(type)
 {}
 
 
@@ -41,22 +38,22 @@ ItemType Item::getType() const
 
 
 /********************************************************************
-** Function: getName: Returns the name of the item.
+** Function: getName: Returns the name of the item's type.
 ** Params:   None
-** Returns:  string: name of the item.
+** Returns:  const string &: name of the item.
 *********************************************************************/
-string Item::getName() const
+const string &Item::getName() const
 {
-    return name;
+    return ITEM_DESC_LT[type].name;
 }
 
 
 /********************************************************************
-** Function: getDesc: Returns the description of the item.
+** Function: getDesc: Returns the description of the item's type.
 ** Params:   None
-** Returns:  string: description of the item.
+** Returns:  const string &: description of the item.
 *********************************************************************/
-string Item::getDesc() const
+const string &Item::getDesc() const
 {
-    return description;
+    return ITEM_DESC_LT[type].description;
 }
@@ -5,7 +5,10 @@
 ** Date: Jun 07, 2019 at 10:04 PM
 ** Description: Class specification file for Item. Item represents
  *              objects/resources that you can use to aid you in your
- *              journey in the Space Escape game.
+ *              journey in the Space Escape game. All items of a type
+ *              are the same, so an item only stores its type and
+ *              looks up its name and description in the shared item
+ *              table. Items are small and are passed by value.
 *********************************************************************/
 
 
@@ -19,23 +22,16 @@ class Item
 {
 private:
     ItemType type;
-    std::string name;
-    std::string description;
 
 public:
 
     /********************************************************************
-    ** Function: Constructor/default: Creates an item instance and sets
-     *              its traits.
+    ** Function: Constructor/default: Creates an item of a type.
     ** Params:   ItemType type: type of item.
      *              default = HEALTHPACK.
-     *           string name: name of item.
-     *              default = "".
-     *           string description: description of item.
-     *              default = "".
     ** Returns:  None
     *********************************************************************/
-    Item(ItemType type = HEALTHPACK, std::string name = "", std::string description = "");
+    Item(ItemType type = HEALTHPACK);
 
 
     /********************************************************************
@@ -47,19 +43,19 @@ public:
 
 
     /********************************************************************
-    ** Function: getName: Returns the name of the item.
+    ** Function: getName: Returns the name of the item's type.
     ** Params:   None
-    ** Returns:  string: name of the item.
+    ** Returns:  const string &: name of the item.
     *********************************************************************/
-    std::string getName() const;
+    const std::string &getName() const;
 
 
     /********************************************************************
-    ** Function: getDesc: Returns the description of the item.
+    ** Function: getDesc: Returns the description of the item's type.
     ** Params:   None
-    ** Returns:  string: description of the item.
+    ** Returns:  const string &: description of the item.
     *********************************************************************/
-    std::string getDesc() const;
+    const std::string &getDesc() const;
 
 };
 
@@ -0,0 +1,376 @@
+/*********************************************************************
+** Program name: JumpPointSearch.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 27, 2019 at 11:15 AM
+** Description: Class implementation file for JumpPointSearch.
+ *              JumpPointSearch finds the fewest steps between two
+ *              cells of a board, moving up, down, left and right and
+ *              going around the cells of a BlockerMap. It is A* that
+ *              only stops at jump points: from each cell it jumps in
+ *              a straight line, over every cell a shortest path could
+ *              just as well reach another way, and only stops where
+ *              the path might have to turn, next to the corner of a
+ *              blocked area, or at the goal. Of all the shortest
+ *              paths it only follows the ones that go up or down
+ *              before they go left or right, so a jump left or right
+ *              stops when a cell above or below opens up past a
+ *              blocked one, and a jump up or down stops on any row
+ *              where a jump left or right would stop. Jumps left and
+ *              right scan the row 64 cells at a time through the
+ *              words of the BlockerMap. On large, mostly open boards
+ *              it looks at far fewer cells than a breadth first
+ *              search or plain A*. Every step counts as 1, so it
+ *              finds the shortest trip, not the one using the least
+ *              oxygen like CostField.
+*********************************************************************/
+
+
+#include <algorithm>
+#include <bitset>
+#include <cstdlib>
+#include <functional>
+#include "JumpPointSearch.hpp"
+
+using std::uint64_t;
+
+//initialize step constants
+const int JumpPointSearch::UNREACHABLE = -1;
+const int JumpPointSearch::FAR = 1 << 30;
+
+//bits per word of a blocker row
+static const int WORD_BITS = BlockerMap::WORD_BITS;
+
+/********************************************************************
+** Function: lowestBit: Returns the position of the lowest set bit.
+** Params:   uint64_t word: word with at least one bit set.
+** Returns:  int: position of the bit, 0 to 63.
+*********************************************************************/
+static int lowestBit(uint64_t word)
+{
+    //the bits below the lowest one, counted
+    return static_cast<int>(std::bitset<WORD_BITS>((word & (~word + 1)) - 1).count());
+}
+
+
+/********************************************************************
+** Function: highestBit: Returns the position of the highest set bit.
+** Params:   uint64_t word: word with at least one bit set.
+** Returns:  int: position of the bit, 0 to 63.
+*********************************************************************/
+static int highestBit(uint64_t word)
+{
+    //spread the highest bit down to bit 0, then count them
+    for (int shift=1; shift<WORD_BITS; shift*=2)
+    {
+        word |= word >> shift;
+    }
+    return static_cast<int>(std::bitset<WORD_BITS>(word).count()) - 1;
+}
+
+
+/********************************************************************
+** Function: Constructor: Creates a search over the cells of a
+ *              blocker map. The map is read when searching, so
+ *              cells can change between searches. Everything a
+ *              search needs is sized here, so searching doesn't
+ *              allocate.
+** Params:   const BlockerMap &blockers: cells that can't be walked
+ *              on, such as the ones of a board.
+** Returns:  None
+*********************************************************************/
+JumpPointSearch::JumpPointSearch(const BlockerMap &blockers)
+        : blockers(blockers), rows(blockers.getRows()), cols(blockers.getCols()),
+          goal(-1), stamp(0), expanded(0)
+{
+    const std::size_t CELLS = static_cast<std::size_t>(rows) * cols;
+
+    //a cell is expanded once and reaches at most 4 jump points, so
+    // searching never has to grow these
+    best.assign(CELLS, FAR);
+    parents.assign(CELLS, -1);
+    stamps.assign(CELLS, 0);
+    closed.assign(CELLS, 0);
+    heap.reserve(4 * CELLS + 1);
+    points.reserve(CELLS);
+}
+
+
+/********************************************************************
+** Function: jumpAcross: Jumps left or right along a row until the
+ *              path might turn.
+** Params:   int x: x-coordinate to jump from.
+ *           int y: y-coordinate to jump from.
+ *           int dx: 1 to jump right, -1 to jump left.
+** Returns:  int: cell of the jump point, or -1 if the jump runs
+ *              into a blocked cell first.
+*********************************************************************/
+int JumpPointSearch::jumpAcross(int x, int y, int dx) const
+{
+    const uint64_t *row = blockers.getRow(y);
+    const uint64_t *above = blockers.getRow(y - 1);
+    const uint64_t *below = blockers.getRow(y + 1);
+    const int WORDS = blockers.getWordsPerRow();
+    const int GOAL_X = (goal / cols == y) ? goal % cols : -1;
+
+    int first = x + dx;
+    if (first < 0)
+    {
+        return -1;
+    }
+
+    //each word is checked for the first cell that is blocked, is the
+    // goal, or has a cell above or below it that opens up past a
+    // blocked one. The row always has a blocked bit past the board
+    for (int word=first / WORD_BITS; word>=0 && word<WORDS; word+=dx)
+    {
+        //blocked bits of the cells above and below the ones behind,
+        // moved over to line up with the cells they are behind
+        uint64_t above_behind = 0;
+        uint64_t below_behind = 0;
+        if (dx > 0)
+        {
+            above_behind = (above[word] << 1) | ((word > 0) ? above[word - 1] >> (WORD_BITS - 1) : 1);
+            below_behind = (below[word] << 1) | ((word > 0) ? below[word - 1] >> (WORD_BITS - 1) : 1);
+        }
+        else
+        {
+            above_behind = (above[word] >> 1) | ((word + 1 < WORDS) ? above[word + 1] << (WORD_BITS - 1) : 0);
+            below_behind = (below[word] >> 1) | ((word + 1 < WORDS) ? below[word + 1] << (WORD_BITS - 1) : 0);
+        }
+
+        uint64_t stops = row[word] | (~above[word] & above_behind) | (~below[word] & below_behind);
+        if (GOAL_X >= 0 && GOAL_X / WORD_BITS == word)
+        {
+            stops |= 1ULL << (GOAL_X % WORD_BITS);
+        }
+
+        //only the cells ahead of where the jump started
+        if (word == first / WORD_BITS)
+        {
+            int bit = first % WORD_BITS;
+            stops &= (dx > 0) ? (~0ULL << bit) : (~0ULL >> (WORD_BITS - 1 - bit));
+        }
+
+        if (stops)
+        {
+            int bit = (dx > 0) ? lowestBit(stops) : highestBit(stops);
+            if ((row[word] >> bit) & 1)
+            {
+                return -1;
+            }
+            return y * cols + word * WORD_BITS + bit;
+        }
+    }
+
+    //ran off the left edge of the board
+    return -1;
+}
+
+
+/********************************************************************
+** Function: jumpAlong: Jumps up or down a column until a jump left
+ *              or right from a cell on the way would stop.
+** Params:   int x: x-coordinate to jump from.
+ *           int y: y-coordinate to jump from.
+ *           int dy: 1 to jump down, -1 to jump up.
+** Returns:  int: cell of the jump point, or -1 if the jump runs
+ *              into a blocked cell first.
+*********************************************************************/
+int JumpPointSearch::jumpAlong(int x, int y, int dy) const
+{
+    for (int row=y + dy; !blockers.isBlocked(x, row); row+=dy)
+    {
+        int cell = row * cols + x;
+        if (cell == goal || jumpAcross(x, row, 1) != -1 || jumpAcross(x, row, -1) != -1)
+        {
+            return cell;
+        }
+    }
+
+    return -1;
+}
+
+
+/********************************************************************
+** Function: reach: Records a shorter way to a jump point and puts
+ *              it on the heap.
+** Params:   int cell: jump point reached.
+ *           int steps: steps to get there.
+ *           int parent: jump point it was reached from, -1 for the
+ *              start.
+** Returns:  None
+*********************************************************************/
+void JumpPointSearch::reach(int cell, int steps, int parent)
+{
+    if (stamps[cell] != stamp)
+    {
+        stamps[cell] = stamp;
+        best[cell] = FAR;
+        closed[cell] = 0;
+    }
+
+    if (closed[cell] || steps >= best[cell])
+    {
+        return;
+    }
+    best[cell] = steps;
+    parents[cell] = parent;
+
+    //every step costs 1, so the distance left never overestimates
+    Open open;
+    open.estimate = steps + std::abs(cell % cols - goal % cols)
+                    + std::abs(cell / cols - goal / cols);
+    open.steps = steps;
+    open.cell = cell;
+    heap.push_back(open);
+    std::push_heap(heap.begin(), heap.end(), std::greater<Open>());
+}
+
+
+/********************************************************************
+** Function: search: Finds the fewest steps between two cells.
+** Params:   int from_x: x-coordinate to start at.
+ *           int from_y: y-coordinate to start at.
+ *           int to_x: x-coordinate to get to.
+ *           int to_y: y-coordinate to get to.
+** Returns:  int: number of steps, or UNREACHABLE.
+*********************************************************************/
+int JumpPointSearch::search(int from_x, int from_y, int to_x, int to_y)
+{
+    const int STEP_X[] = {1, -1, 0, 0};
+    const int STEP_Y[] = {0, 0, 1, -1};
+
+    points.clear();
+    expanded = 0;
+
+    if (blockers.isBlocked(from_x, from_y) || blockers.isBlocked(to_x, to_y))
+    {
+        return UNREACHABLE;
+    }
+
+    //a new stamp forgets the last search
+    if (++stamp == 0)
+    {
+        std::fill(stamps.begin(), stamps.end(), 0);
+        stamp = 1;
+    }
+    heap.clear();
+
+    int start = from_y * cols + from_x;
+    goal = to_y * cols + to_x;
+    reach(start, 0, -1);
+
+    while (!heap.empty())
+    {
+        Open top = heap.front();
+        std::pop_heap(heap.begin(), heap.end(), std::greater<Open>());
+        heap.pop_back();
+
+        if (closed[top.cell])
+        {
+            continue;
+        }
+        closed[top.cell] = 1;
+        expanded++;
+
+        if (top.cell == goal)
+        {
+            //walk back from the goal
+            for (int cell=goal; cell!=-1; cell=parents[cell])
+            {
+                points.push_back(cell);
+            }
+            std::reverse(points.begin(), points.end());
+            return top.steps;
+        }
+
+        int x = top.cell % cols;
+        int y = top.cell / cols;
+        int parent = parents[top.cell];
+        int from_dx = 0;
+        int from_dy = 0;
+        if (parent != -1)
+        {
+            from_dx = (x > parent % cols) - (x < parent % cols);
+            from_dy = (y > parent / cols) - (y < parent / cols);
+        }
+
+        for (int k=0; k<4; k++)
+        {
+            int dx = STEP_X[k];
+            int dy = STEP_Y[k];
+
+            //never straight back, and after a step left or right only
+            // up or down where the cell behind that way is blocked,
+            // since any other shortest path there went up or down first
+            if (dx == -from_dx && dy == -from_dy && parent != -1)
+            {
+                continue;
+            }
+            if (from_dx && dy && !(blockers.isBlocked(x - from_dx, y + dy)
+                                   && !blockers.isBlocked(x, y + dy)))
+            {
+                continue;
+            }
+
+            int found = dx ? jumpAcross(x, y, dx) : jumpAlong(x, y, dy);
+            if (found != -1)
+            {
+                reach(found, top.steps + std::abs(found % cols - x)
+                             + std::abs(found / cols - y), top.cell);
+            }
+        }
+    }
+
+    return UNREACHABLE;
+}
+
+
+/********************************************************************
+** Function: path: Turns the last trip found into the cells to walk
+ *              through.
+** Params:   vector<int> &cells: the cells of the trip, as
+ *              y * cols + x, are added to the end, not counting
+ *              the cell the trip starts on.
+** Returns:  None
+*********************************************************************/
+void JumpPointSearch::path(std::vector<int> &cells) const
+{
+    //jump points are joined by straight lines
+    for (std::size_t i=1; i<points.size(); i++)
+    {
+        int from = points[i - 1];
+        int to = points[i];
+        int step = (to % cols != from % cols) ? ((to > from) ? 1 : -1)
+                                              : ((to > from) ? cols : -cols);
+
+        for (int cell=from + step; cell!=to + step; cell+=step)
+        {
+            cells.push_back(cell);
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: jumpPointCount: Returns how many jump points the last
+ *              trip has, counting the start and the goal.
+** Params:   None
+** Returns:  int: number of jump points, 0 if no trip was found.
+*********************************************************************/
+int JumpPointSearch::jumpPointCount() const
+{
+    return static_cast<int>(points.size());
+}
+
+
+/********************************************************************
+** Function: expandedCount: Returns how many jump points the last
+ *              search looked past.
+** Params:   None
+** Returns:  int: number of jump points expanded.
+*********************************************************************/
+int JumpPointSearch::expandedCount() const
+{
+    return expanded;
+}
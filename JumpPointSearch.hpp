@@ -0,0 +1,175 @@
+/*********************************************************************
+** Program name: JumpPointSearch.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 27, 2019 at 11:15 AM
+** Description: Class specification file for JumpPointSearch.
+ *              JumpPointSearch finds the fewest steps between two
+ *              cells of a board, moving up, down, left and right and
+ *              going around the cells of a BlockerMap. It is A* that
+ *              only stops at jump points: from each cell it jumps in
+ *              a straight line, over every cell a shortest path could
+ *              just as well reach another way, and only stops where
+ *              the path might have to turn, next to the corner of a
+ *              blocked area, or at the goal. Of all the shortest
+ *              paths it only follows the ones that go up or down
+ *              before they go left or right, so a jump left or right
+ *              stops when a cell above or below opens up past a
+ *              blocked one, and a jump up or down stops on any row
+ *              where a jump left or right would stop. Jumps left and
+ *              right scan the row 64 cells at a time through the
+ *              words of the BlockerMap. On large, mostly open boards
+ *              it looks at far fewer cells than a breadth first
+ *              search or plain A*. Every step counts as 1, so it
+ *              finds the shortest trip, not the one using the least
+ *              oxygen like CostField.
+*********************************************************************/
+
+
+#ifndef JUMP_POINT_SEARCH_HPP
+#define JUMP_POINT_SEARCH_HPP
+
+#include <vector>
+#include "BlockerMap.hpp"
+
+class JumpPointSearch
+{
+public:
+    //steps reported for trips that can't be made
+    static const int UNREACHABLE;
+
+private:
+    //stored steps of cells that haven't been reached
+    static const int FAR;
+
+    //a jump point waiting in the heap, ties go to the one furthest
+    // along
+    struct Open
+    {
+        int estimate;
+        int steps;
+        int cell;
+
+        bool operator>(const Open &other) const
+        {
+            return estimate > other.estimate
+                   || (estimate == other.estimate && steps < other.steps);
+        }
+    };
+
+    //cells that can't be walked on, not owned
+    const BlockerMap &blockers;
+
+    int rows;
+    int cols;
+
+    //cell to get to, as y * cols + x
+    int goal;
+
+    //search state of each cell, only valid when its stamp matches
+    // the current search
+    std::vector<int> best;
+    std::vector<int> parents;
+    std::vector<unsigned int> stamps;
+    std::vector<unsigned char> closed;
+    unsigned int stamp;
+    std::vector<Open> heap;
+
+    //jump points of the last trip found, from the start to the goal
+    std::vector<int> points;
+
+    //jump points taken off the heap by the last search
+    int expanded;
+
+
+    /********************************************************************
+    ** Function: jumpAcross: Jumps left or right along a row until the
+     *              path might turn.
+    ** Params:   int x: x-coordinate to jump from.
+     *           int y: y-coordinate to jump from.
+     *           int dx: 1 to jump right, -1 to jump left.
+    ** Returns:  int: cell of the jump point, or -1 if the jump runs
+     *              into a blocked cell first.
+    *********************************************************************/
+    int jumpAcross(int x, int y, int dx) const;
+
+
+    /********************************************************************
+    ** Function: jumpAlong: Jumps up or down a column until a jump left
+     *              or right from a cell on the way would stop.
+    ** Params:   int x: x-coordinate to jump from.
+     *           int y: y-coordinate to jump from.
+     *           int dy: 1 to jump down, -1 to jump up.
+    ** Returns:  int: cell of the jump point, or -1 if the jump runs
+     *              into a blocked cell first.
+    *********************************************************************/
+    int jumpAlong(int x, int y, int dy) const;
+
+
+    /********************************************************************
+    ** Function: reach: Records a shorter way to a jump point and puts
+     *              it on the heap.
+    ** Params:   int cell: jump point reached.
+     *           int steps: steps to get there.
+     *           int parent: jump point it was reached from, -1 for the
+     *              start.
+    ** Returns:  None
+    *********************************************************************/
+    void reach(int cell, int steps, int parent);
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor: Creates a search over the cells of a
+     *              blocker map. The map is read when searching, so
+     *              cells can change between searches. Everything a
+     *              search needs is sized here, so searching doesn't
+     *              allocate.
+    ** Params:   const BlockerMap &blockers: cells that can't be walked
+     *              on, such as the ones of a board.
+    ** Returns:  None
+    *********************************************************************/
+    JumpPointSearch(const BlockerMap &blockers);
+
+
+    /********************************************************************
+    ** Function: search: Finds the fewest steps between two cells.
+    ** Params:   int from_x: x-coordinate to start at.
+     *           int from_y: y-coordinate to start at.
+     *           int to_x: x-coordinate to get to.
+     *           int to_y: y-coordinate to get to.
+    ** Returns:  int: number of steps, or UNREACHABLE.
+    *********************************************************************/
+    int search(int from_x, int from_y, int to_x, int to_y);
+
+
+    /********************************************************************
+    ** Function: path: Turns the last trip found into the cells to walk
+     *              through.
+    ** Params:   vector<int> &cells: the cells of the trip, as
+     *              y * cols + x, are added to the end, not counting
+     *              the cell the trip starts on.
+    ** Returns:  None
+    *********************************************************************/
+    void path(std::vector<int> &cells) const;
+
+
+    /********************************************************************
+    ** Function: jumpPointCount: Returns how many jump points the last
+     *              trip has, counting the start and the goal.
+    ** Params:   None
+    ** Returns:  int: number of jump points, 0 if no trip was found.
+    *********************************************************************/
+    int jumpPointCount() const;
+
+
+    /********************************************************************
+    ** Function: expandedCount: Returns how many jump points the last
+     *              search looked past.
+    ** Params:   None
+    ** Returns:  int: number of jump points expanded.
+    *********************************************************************/
+    int expandedCount() const;
+
+};
+
+#endif
@@ -0,0 +1,190 @@
+/*********************************************************************
+** Program name: MapExport.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 14, 2019 at 11:05 AM
+** Description: Class implementation file for MapExport. MapExport has
+ *              static functions that stream a board of any size to a
+ *              compact run-length encoded text dump and to a PPM
+ *              image with one pixel per tile. Both work one row at a
+ *              time, so the whole map or image is never held in
+ *              memory. See MapExport.hpp for both formats.
+*********************************************************************/
+
+
+#include <string>
+#include <vector>
+#include "MapExport.hpp"
+#include "AsteroidObject.hpp"
+
+using std::ostream;
+using std::string;
+using std::vector;
+
+//markers for what is hidden in a cell
+static const char ALIEN_MARKER = 'a';
+static const char ITEM_MARKER = 'i';
+
+//pixel colors, indexed by SpaceType
+static const unsigned char TILE_COLORS[][3] =
+        {{200, 40, 40},     //rocket ship
+         {90, 90, 100},     //crater
+         {140, 110, 80},    //space rock
+         {150, 60, 210},    //worm hole
+         {190, 190, 185},   //ground
+         {35, 25, 30},      //chasm
+         {0, 0, 0}};        //default space
+
+static const unsigned char ALIEN_COLOR[] = {40, 220, 40};
+static const unsigned char ITEM_COLOR[] = {240, 210, 40};
+
+/********************************************************************
+** Function: cellContents: Checks what is hidden in a cell.
+** Params:   const Space *space: space in the cell.
+ *           bool &alien: set to true if an alien hides there.
+ *           bool &item: set to true if an item is hidden there.
+** Returns:  None
+*********************************************************************/
+static void cellContents(const Space *space, bool &alien, bool &item)
+{
+    //only AsteroidObject spaces can hide aliens and items
+    const AsteroidObject *landmark = dynamic_cast<const AsteroidObject*>(space);
+
+    alien = landmark && landmark->hasAlien();
+    item = landmark && landmark->hasTreasure();
+}
+
+
+/********************************************************************
+** Function: appendRun: Appends one run to the encoded row.
+** Params:   string &row: encoded row to append to.
+ *           int count: length of the run.
+ *           char icon: space icon of the run.
+ *           bool alien: if the run's cells hide an alien.
+ *           bool item: if the run's cells hide an item.
+** Returns:  None
+*********************************************************************/
+static void appendRun(string &row, int count, char icon, bool alien, bool item)
+{
+    row += std::to_string(count);
+    row += icon;
+
+    if (alien)
+    {
+        row += ALIEN_MARKER;
+    }
+    if (item)
+    {
+        row += ITEM_MARKER;
+    }
+}
+
+
+/********************************************************************
+** Function: writeRLE: Streams the board as run-length encoded text.
+** Params:   const Board &board: board to export.
+ *           ostream &out: stream to write the dump to.
+** Returns:  None
+*********************************************************************/
+void MapExport::writeRLE(const Board &board, ostream &out)
+{
+    int rows = board.getRows();
+    int cols = board.getCols();
+
+    //encoded row, reused for every row
+    string row;
+
+    out << "SPACEMAP " << cols << " " << rows << "\n";
+
+    for (int y=0; y<rows; y++)
+    {
+        row.clear();
+
+        //start the first run with the first cell
+        const Space *space = board.getSpace(0, y);
+        char run_icon = space->getIcon();
+        bool run_alien = false;
+        bool run_item = false;
+        cellContents(space, run_alien, run_item);
+        int run_length = 1;
+
+        for (int x=1; x<cols; x++)
+        {
+            space = board.getSpace(x, y);
+            char icon = space->getIcon();
+            bool alien = false;
+            bool item = false;
+            cellContents(space, alien, item);
+
+            if (icon == run_icon && alien == run_alien && item == run_item)
+            {
+                //same cell, extend the run
+                run_length++;
+            }
+            else
+            {
+                //different cell, close the run and start a new one
+                appendRun(row, run_length, run_icon, run_alien, run_item);
+                run_icon = icon;
+                run_alien = alien;
+                run_item = item;
+                run_length = 1;
+            }
+        }
+
+        //close the last run
+        appendRun(row, run_length, run_icon, run_alien, run_item);
+        row += '\n';
+
+        out.write(row.data(), row.size());
+    }
+}
+
+
+/********************************************************************
+** Function: writePPM: Streams the board as a binary PPM image with
+ *              one pixel per tile.
+** Params:   const Board &board: board to export.
+ *           ostream &out: stream to write the image to. Should be
+ *              opened in binary mode.
+** Returns:  None
+*********************************************************************/
+void MapExport::writePPM(const Board &board, ostream &out)
+{
+    const int CHANNELS = 3;
+    int rows = board.getRows();
+    int cols = board.getCols();
+
+    //one row of pixels, reused for every row
+    vector<char> pixels(static_cast<size_t>(cols) * CHANNELS);
+
+    out << "P6\n" << cols << " " << rows << "\n255\n";
+
+    for (int y=0; y<rows; y++)
+    {
+        for (int x=0; x<cols; x++)
+        {
+            const Space *space = board.getSpace(x, y);
+            bool alien = false;
+            bool item = false;
+            cellContents(space, alien, item);
+
+            //aliens are found before items, so draw them on top
+            const unsigned char *color = TILE_COLORS[space->getType()];
+            if (alien)
+            {
+                color = ALIEN_COLOR;
+            }
+            else if (item)
+            {
+                color = ITEM_COLOR;
+            }
+
+            for (int c=0; c<CHANNELS; c++)
+            {
+                pixels[static_cast<size_t>(x) * CHANNELS + c] = static_cast<char>(color[c]);
+            }
+        }
+
+        out.write(pixels.data(), pixels.size());
+    }
+}
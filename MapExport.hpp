@@ -0,0 +1,55 @@
+/*********************************************************************
+** Program name: MapExport.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 14, 2019 at 11:05 AM
+** Description: Class specification file for MapExport. MapExport has
+ *              static functions that stream a board of any size to a
+ *              compact run-length encoded text dump and to a PPM
+ *              image with one pixel per tile. Both work one row at a
+ *              time, so the whole map or image is never held in
+ *              memory.
+ *
+ *              RLE format: a header line "SPACEMAP <cols> <rows>",
+ *              then one line per row made of runs "<count><cell>".
+ *              A cell is the space icon, followed by 'a' if an alien
+ *              hides there and 'i' if an item is hidden there.
+ *              e.g. "3_1Oa2#i" is three ground cells, a crater with an
+ *              alien and two space rocks with items.
+ *
+ *              PPM format: binary P6. Tiles are colored by space type.
+ *              Aliens are drawn green and items yellow on top.
+*********************************************************************/
+
+
+#ifndef MAP_EXPORT_HPP
+#define MAP_EXPORT_HPP
+
+#include <iostream>
+#include "Board.hpp"
+
+class MapExport
+{
+public:
+
+    /********************************************************************
+    ** Function: writeRLE: Streams the board as run-length encoded text.
+    ** Params:   const Board &board: board to export.
+     *           ostream &out: stream to write the dump to.
+    ** Returns:  None
+    *********************************************************************/
+    static void writeRLE(const Board &board, std::ostream &out);
+
+
+    /********************************************************************
+    ** Function: writePPM: Streams the board as a binary PPM image with
+     *              one pixel per tile.
+    ** Params:   const Board &board: board to export.
+     *           ostream &out: stream to write the image to. Should be
+     *              opened in binary mode.
+    ** Returns:  None
+    *********************************************************************/
+    static void writePPM(const Board &board, std::ostream &out);
+
+};
+
+#endif
@@ -0,0 +1,83 @@
+/*********************************************************************
+** Program name: MemoryIO.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 20, 2019 at 2:45 PM
+** Description: Class implementation file for MemoryIO. MemoryIO is
+ *              an IOBackend that reads input from a string and
+ *              prints output into a MemorySink, so a game can be fed
+ *              answers and have its screen checked without a
+ *              terminal.
+*********************************************************************/
+
+
+#include "MemoryIO.hpp"
+
+using std::string;
+
+/********************************************************************
+** Function: Constructor/default: Creates a backend with the given
+ *              input and no output yet.
+** Params:   const string &text: input to read from.
+ *              default = empty.
+** Returns:  None
+*********************************************************************/
+MemoryIO::MemoryIO(const string &text) : source(text)
+{}
+
+
+/********************************************************************
+** Function: input: Returns the stream reading the input string.
+** Params:   None
+** Returns:  istream &: input stream.
+*********************************************************************/
+std::istream &MemoryIO::input()
+{
+    return source;
+}
+
+
+/********************************************************************
+** Function: output: Returns the sink collecting the output.
+** Params:   None
+** Returns:  ostream &: output stream.
+*********************************************************************/
+std::ostream &MemoryIO::output()
+{
+    return sink;
+}
+
+
+/********************************************************************
+** Function: setInput: Replaces the input with a new string and
+ *              starts reading from its beginning.
+** Params:   const string &text: input to read from.
+** Returns:  None
+*********************************************************************/
+void MemoryIO::setInput(const string &text)
+{
+    source.clear();
+    source.str(text);
+}
+
+
+/********************************************************************
+** Function: getOutput: Returns everything printed since the last
+ *              reset.
+** Params:   None
+** Returns:  const string &: the output.
+*********************************************************************/
+const string &MemoryIO::getOutput()
+{
+    return sink.str();
+}
+
+
+/********************************************************************
+** Function: resetOutput: Discards the output, keeping its capacity.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void MemoryIO::resetOutput()
+{
+    sink.reset();
+}
@@ -0,0 +1,82 @@
+/*********************************************************************
+** Program name: MemoryIO.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 20, 2019 at 2:45 PM
+** Description: Class specification file for MemoryIO. MemoryIO is
+ *              an IOBackend that reads input from a string and
+ *              prints output into a MemorySink, so a game can be fed
+ *              answers and have its screen checked without a
+ *              terminal.
+*********************************************************************/
+
+
+#ifndef MEMORY_IO_HPP
+#define MEMORY_IO_HPP
+
+#include <sstream>
+#include <string>
+#include "IOBackend.hpp"
+#include "MemorySink.hpp"
+
+class MemoryIO : public IOBackend
+{
+private:
+    std::istringstream source;
+    MemorySink sink;
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Creates a backend with the given
+     *              input and no output yet.
+    ** Params:   const string &text: input to read from.
+     *              default = empty.
+    ** Returns:  None
+    *********************************************************************/
+    MemoryIO(const std::string &text = "");
+
+
+    /********************************************************************
+    ** Function: input: Returns the stream reading the input string.
+    ** Params:   None
+    ** Returns:  istream &: input stream.
+    *********************************************************************/
+    virtual std::istream &input() override;
+
+
+    /********************************************************************
+    ** Function: output: Returns the sink collecting the output.
+    ** Params:   None
+    ** Returns:  ostream &: output stream.
+    *********************************************************************/
+    virtual std::ostream &output() override;
+
+
+    /********************************************************************
+    ** Function: setInput: Replaces the input with a new string and
+     *              starts reading from its beginning.
+    ** Params:   const string &text: input to read from.
+    ** Returns:  None
+    *********************************************************************/
+    void setInput(const std::string &text);
+
+
+    /********************************************************************
+    ** Function: getOutput: Returns everything printed since the last
+     *              reset.
+    ** Params:   None
+    ** Returns:  const string &: the output.
+    *********************************************************************/
+    const std::string &getOutput();
+
+
+    /********************************************************************
+    ** Function: resetOutput: Discards the output, keeping its capacity.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void resetOutput();
+
+};
+
+#endif
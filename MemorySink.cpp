@@ -0,0 +1,107 @@
+/*********************************************************************
+** Program name: MemorySink.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 12, 2019 at 4:15 PM
+** Description: Class implementation file for MemorySink. MemorySink
+ *              is an output stream that renders into a contiguous
+ *              in-memory buffer instead of the terminal. Anything
+ *              that prints to a std::ostream (the board, the game
+ *              screen, menus) can target it. The buffer keeps its
+ *              capacity when reset, so rendering frame after frame
+ *              into the same sink does not re-allocate.
+*********************************************************************/
+
+
+#include "MemorySink.hpp"
+
+using std::string;
+using std::size_t;
+
+/********************************************************************
+** Function: Buffer::overflow: Appends a single character.
+** Params:   int_type c: character to append.
+** Returns:  int_type: the character written, or eof on eof input.
+*********************************************************************/
+MemorySink::Buffer::int_type MemorySink::Buffer::overflow(int_type c)
+{
+    if (traits_type::eq_int_type(c, traits_type::eof()))
+    {
+        return traits_type::not_eof(c);
+    }
+
+    data.push_back(traits_type::to_char_type(c));
+    return c;
+}
+
+
+/********************************************************************
+** Function: Buffer::xsputn: Appends a run of characters.
+** Params:   const char *s: characters to append.
+ *           streamsize n: number of characters to append.
+** Returns:  streamsize: number of characters written.
+*********************************************************************/
+std::streamsize MemorySink::Buffer::xsputn(const char *s, std::streamsize n)
+{
+    data.append(s, static_cast<size_t>(n));
+    return n;
+}
+
+
+/********************************************************************
+** Function: Buffer::str: Returns the underlying string.
+** Params:   None
+** Returns:  string &: the buffered output.
+*********************************************************************/
+string &MemorySink::Buffer::str()
+{
+    return data;
+}
+
+
+/********************************************************************
+** Function: Constructor/default: Creates an empty sink, optionally
+ *              reserving room for the expected frame size.
+** Params:   size_t capacity: bytes to reserve up front.
+ *              default = 0.
+** Returns:  None
+*********************************************************************/
+MemorySink::MemorySink(size_t capacity) : std::ostream(nullptr)
+{
+    buffer.str().reserve(capacity);
+    rdbuf(&buffer);
+}
+
+
+/********************************************************************
+** Function: reset: Discards the buffered output but keeps the
+ *              allocated capacity for the next frame.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void MemorySink::reset()
+{
+    buffer.str().clear();
+    std::ostream::clear();
+}
+
+
+/********************************************************************
+** Function: size: Returns the number of bytes buffered.
+** Params:   None
+** Returns:  size_t: number of bytes written since the last reset.
+*********************************************************************/
+size_t MemorySink::size()
+{
+    return buffer.str().size();
+}
+
+
+/********************************************************************
+** Function: str: Returns the buffered output.
+** Params:   None
+** Returns:  const string &: everything written since the last reset.
+*********************************************************************/
+const string &MemorySink::str()
+{
+    return buffer.str();
+}
@@ -0,0 +1,80 @@
+/*********************************************************************
+** Program name: MemorySink.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 12, 2019 at 4:15 PM
+** Description: Class specification file for MemorySink. MemorySink
+ *              is an output stream that renders into a contiguous
+ *              in-memory buffer instead of the terminal. Anything
+ *              that prints to a std::ostream (the board, the game
+ *              screen, menus) can target it. The buffer keeps its
+ *              capacity when reset, so rendering frame after frame
+ *              into the same sink does not re-allocate.
+*********************************************************************/
+
+
+#ifndef MEMORY_SINK_HPP
+#define MEMORY_SINK_HPP
+
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <cstddef>
+
+class MemorySink : public std::ostream
+{
+private:
+    //stream buffer that appends everything written to a string
+    class Buffer : public std::streambuf
+    {
+    private:
+        std::string data;
+
+    protected:
+        virtual int_type overflow(int_type c) override;
+        virtual std::streamsize xsputn(const char *s, std::streamsize n) override;
+
+    public:
+        std::string &str();
+    };
+
+    Buffer buffer;
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Creates an empty sink, optionally
+     *              reserving room for the expected frame size.
+    ** Params:   size_t capacity: bytes to reserve up front.
+     *              default = 0.
+    ** Returns:  None
+    *********************************************************************/
+    MemorySink(std::size_t capacity = 0);
+
+
+    /********************************************************************
+    ** Function: reset: Discards the buffered output but keeps the
+     *              allocated capacity for the next frame.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void reset();
+
+
+    /********************************************************************
+    ** Function: size: Returns the number of bytes buffered.
+    ** Params:   None
+    ** Returns:  size_t: number of bytes written since the last reset.
+    *********************************************************************/
+    std::size_t size();
+
+
+    /********************************************************************
+    ** Function: str: Returns the buffered output.
+    ** Params:   None
+    ** Returns:  const string &: everything written since the last reset.
+    *********************************************************************/
+    const std::string &str();
+
+};
+
+#endif
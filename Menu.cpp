@@ -11,13 +11,12 @@
  *              from a list, and prompt users to enter an integer
  *              or float with a message string provided as an
  *              argument, along with the range of acceptable numbers.
+ *              Menus print to the current IOBackend.
 *********************************************************************/
 // TODO: Validation: Start and Quit values can not be the same value
 
 #include "Menu.hpp"
 
-using std::cout;
-using std::cin;
 using std::endl;
 using std::string;
 
@@ -26,6 +25,8 @@ const int Menu::START_VALUE_DEFAULT = 1;
 const int Menu::QUIT_VALUE_DEFAULT = 2;
 const int Menu::PLAY_AGAIN_VALUE_DEFAULT = 1;
 const int Menu::START_MENU_SIZE = 2;
+const string Menu::BORDER_WALL = string(78, '=');
+bool Menu::autoConfirm = false;
 
 /********************************************************************
 ** Function: Default constructor - Sets program name to empty string
@@ -165,10 +166,10 @@ int Menu::getStartMenuSize() const
 int Menu::start() const
 {
     printBorder();
-    cout << endl;
+    IOBackend::out() << endl;
 
-    cout << startValue << ": Start " << programName << endl;
-    cout << quitValue << ": Quit " << endl;
+    IOBackend::out() << startValue << ": Start " << programName << endl;
+    IOBackend::out() << quitValue << ": Quit " << endl;
 
     printBorder();
 
@@ -187,12 +188,12 @@ int Menu::start() const
 int Menu::play() const
 {
     printBorder();
-    cout << endl;
+    IOBackend::out() << endl;
 
 //    cout << startValue << ": Play game" << endl;
 //    cout << quitValue << ": Exit game" << endl;
-    cout << startValue << ": Play" << endl;
-    cout << quitValue << ": Exit" << endl;  //specific prompts for tournament project 4
+    IOBackend::out() << startValue << ": Play" << endl;
+    IOBackend::out() << quitValue << ": Exit" << endl;  //specific prompts for tournament project 4
 
     printBorder();
 
@@ -211,12 +212,12 @@ int Menu::play() const
 int Menu::playAgain() const
 {
     printBorder();
-    cout << endl;
+    IOBackend::out() << endl;
 
-    cout << "Do you want to play again?" << endl << endl;
-    cout << playAgainValue << ": Play again" << endl;
+    IOBackend::out() << "Do you want to play again?" << endl << endl;
+    IOBackend::out() << playAgainValue << ": Play again" << endl;
 //    cout << quitValue << ": Quit " << endl;
-    cout << quitValue << ": Exit " << endl; //specific prompt for tournament project 4
+    IOBackend::out() << quitValue << ": Exit " << endl; //specific prompt for tournament project 4
 
     printBorder();
 
@@ -244,20 +245,7 @@ int Menu::playAgain() const
 int Menu::chooseOne(const string * choices, int size,
         const string &message, bool include_random, bool is_seeded) const
 {
-    printBorder();
-    cout << endl;
-
-    if (message.length())
-    {
-        cout << message << endl << endl;
-    }
-
-    for (int i=0; i<size; i++)
-    {
-        cout << i+1 << ": " << choices[i] << endl;
-    }
-
-    printBorder();
+    printChoices(choices, size, message);
 
     int selection = ValidateInput::validateInteger(START_VALUE_DEFAULT, size);
 
@@ -276,6 +264,35 @@ int Menu::chooseOne(const string * choices, int size,
 }
 
 
+/********************************************************************
+** Function: printChoices - prints a message and a numbered list of
+ *           choices between borders, the same way chooseOne does,
+ *           without reading a selection.
+** Params:   const string * choices - array of choices to print.
+ *           int size - size of choices array.
+ *           const string & message - message prompt. Default = empty.
+** Returns:  None
+*********************************************************************/
+void Menu::printChoices(const string * choices, int size,
+        const string &message) const
+{
+    printBorder();
+    IOBackend::out() << endl;
+
+    if (message.length())
+    {
+        IOBackend::out() << message << endl << endl;
+    }
+
+    for (int i=0; i<size; i++)
+    {
+        IOBackend::out() << i+1 << ": " << choices[i] << endl;
+    }
+
+    printBorder();
+}
+
+
 /********************************************************************
 ** Function: promptForInteger - prompts user with provided message
  *           string for a number (no range).
@@ -285,9 +302,9 @@ int Menu::chooseOne(const string * choices, int size,
 int Menu::promptForInteger(const string &message)
 {
     printBorder();
-    cout << endl;
+    IOBackend::out() << endl;
 
-    cout << message << endl;
+    IOBackend::out() << message << endl;
 
     printBorder();
     return ValidateInput::validateInteger();
@@ -307,9 +324,9 @@ int Menu::promptForInteger(const string &message,
         int range_start, int range_end) const
 {
     printBorder();
-    cout << endl;
+    IOBackend::out() << endl;
 
-    cout << message << endl;
+    IOBackend::out() << message << endl;
 
     printBorder();
     return ValidateInput::validateInteger(range_start, range_end);
@@ -328,9 +345,9 @@ double Menu::promptForFloat(const std::string &message,
                    double range_start, double range_end) const
 {
     printBorder();
-    cout << endl;
+    IOBackend::out() << endl;
 
-    cout << message << endl;
+    IOBackend::out() << message << endl;
 
     printBorder();
     return ValidateInput::validateFloat(range_start, range_end);
@@ -349,21 +366,52 @@ double Menu::promptForFloat(const std::string &message,
 *********************************************************************/
 int Menu::confirm(const string &message) const
 {
+    //scripted games skip the prompt
+    if (autoConfirm)
+    {
+        return YES;
+    }
+
     printBorder();
-    cout << endl;
+    IOBackend::out() << endl;
 
     if (message.length())
     {
-        cout << message << endl << endl;
+        IOBackend::out() << message << endl << endl;
     }
-    cout << YES << ": Yes" << endl;
-    cout << NO  << ": No"  << endl;
+    IOBackend::out() << YES << ": Yes" << endl;
+    IOBackend::out() << NO  << ": No"  << endl;
 
     printBorder();
     return ValidateInput::validateInteger(YES, NO);
 }
 
 
+/********************************************************************
+** Function: setAutoConfirm: turns automatic confirmation on or off
+ *           for every menu. While on, confirm() answers yes
+ *           without printing or reading input.
+** Params:   bool value: true to answer yes automatically.
+** Returns:  None
+*********************************************************************/
+void Menu::setAutoConfirm(bool value)
+{
+    autoConfirm = value;
+}
+
+
+/********************************************************************
+** Function: isAutoConfirm: checks if confirmations are answered
+ *           automatically.
+** Params:   None
+** Returns:  bool: true if confirm() answers yes by itself.
+*********************************************************************/
+bool Menu::isAutoConfirm()
+{
+    return autoConfirm;
+}
+
+
 /********************************************************************
 ** Function: formatPrompt: prints prompt message formatted to match
  *           other menu prompts.
@@ -374,8 +422,8 @@ void Menu::formatPrompt(const string &message) const
 {
     printBorder();
 
-    cout << endl;
-    cout << message << endl;
+    IOBackend::out() << endl;
+    IOBackend::out() << message << endl;
 
     printBorder();
 }
@@ -384,14 +432,13 @@ void Menu::formatPrompt(const string &message) const
 /********************************************************************
 ** Function: printBorder: prints a top/bottom border for menus and
  *           prompts. Includes top and bottom padding.
-** Params:   None
+** Params:   ostream &out - stream to print the border to.
+ *           Default = the current IOBackend output.
 ** Returns:  None
 *********************************************************************/
-void Menu::printBorder() const
+void Menu::printBorder(std::ostream &out) const
 {
-    const int borderSize = 78;
-    const char borderWall = '=';
     const char borderCorner = '@';
-    cout << endl << borderCorner << string(borderSize, borderWall)
+    out << endl << borderCorner << BORDER_WALL
             << borderCorner << endl;
 }
@@ -11,6 +11,7 @@
  *              from a list, and prompt users to enter an integer
  *              or float with a message string provided as an
  *              argument, along with the range of acceptable numbers.
+ *              Menus print to the current IOBackend.
 *********************************************************************/
 
 
@@ -34,12 +35,18 @@ public:
     static const int PLAY_AGAIN_VALUE_DEFAULT;
     static const int START_MENU_SIZE;
 
+    //border wall printed by printBorder, built once
+    static const std::string BORDER_WALL;
+
 private:
     std::string programName;
     int startValue;
     int quitValue;
     int playAgainValue;
     const int startMenuSize;
+
+    //answer every confirmation with yes, used by scripted games
+    static bool autoConfirm;
 public:
 
     /********************************************************************
@@ -185,6 +192,19 @@ public:
             bool is_seeded = false) const;
 
 
+    /********************************************************************
+    ** Function: printChoices - prints a message and a numbered list of
+     *           choices between borders, the same way chooseOne does,
+     *           without reading a selection.
+    ** Params:   const string * choices - array of choices to print.
+     *           int size - size of choices array.
+     *           const string & message - message prompt. Default = empty.
+    ** Returns:  None
+    *********************************************************************/
+    void printChoices(const std::string *, int size,
+            const std::string &message = "") const;
+
+
     /********************************************************************
     ** Function: promptForInteger - prompts user with provided message
      *           string for a number (no range).
@@ -232,6 +252,25 @@ public:
     int confirm(const std::string & = "") const;
 
 
+    /********************************************************************
+    ** Function: setAutoConfirm: turns automatic confirmation on or off
+     *           for every menu. While on, confirm() answers yes
+     *           without printing or reading input.
+    ** Params:   bool value: true to answer yes automatically.
+    ** Returns:  None
+    *********************************************************************/
+    static void setAutoConfirm(bool value);
+
+
+    /********************************************************************
+    ** Function: isAutoConfirm: checks if confirmations are answered
+     *           automatically.
+    ** Params:   None
+    ** Returns:  bool: true if confirm() answers yes by itself.
+    *********************************************************************/
+    static bool isAutoConfirm();
+
+
     /********************************************************************
     ** Function: formatPrompt: prints prompt message formatted to match
      *           other menu prompts.
@@ -244,10 +283,11 @@ public:
     /********************************************************************
     ** Function: printBorder: prints a top/bottom border for menus and
      *           prompts. Includes top and bottom padding.
-    ** Params:   None
+    ** Params:   ostream &out - stream to print the border to.
+     *           Default = the current IOBackend output.
     ** Returns:  None
     *********************************************************************/
-    void printBorder() const;
+    void printBorder(std::ostream &out = IOBackend::out()) const;
 
 };
 
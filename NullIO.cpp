@@ -0,0 +1,49 @@
+/*********************************************************************
+** Program name: NullIO.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 20, 2019 at 2:45 PM
+** Description: Class implementation file for NullIO. NullIO is an
+ *              IOBackend that discards all output and has no input.
+ *              Its streams have no buffer, so printing to them fails
+ *              right away without formatting anything, which is the
+ *              fastest way to run the game silently. Reading from it
+ *              always fails, so it is meant for games that don't
+ *              prompt, such as scripted games.
+*********************************************************************/
+
+
+#include "NullIO.hpp"
+
+/********************************************************************
+** Function: Constructor/default: Creates streams with no buffer.
+ *              A stream without a buffer stays bad even when it is
+ *              cleared, so every read and write fails.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+NullIO::NullIO() : source(nullptr), sink(nullptr)
+{}
+
+
+/********************************************************************
+** Function: input: Returns an input stream that never has any
+ *              input.
+** Params:   None
+** Returns:  istream &: input stream.
+*********************************************************************/
+std::istream &NullIO::input()
+{
+    return source;
+}
+
+
+/********************************************************************
+** Function: output: Returns an output stream that discards
+ *              everything.
+** Params:   None
+** Returns:  ostream &: output stream.
+*********************************************************************/
+std::ostream &NullIO::output()
+{
+    return sink;
+}
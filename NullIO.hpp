@@ -0,0 +1,57 @@
+/*********************************************************************
+** Program name: NullIO.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 20, 2019 at 2:45 PM
+** Description: Class specification file for NullIO. NullIO is an
+ *              IOBackend that discards all output and has no input.
+ *              Its streams have no buffer, so printing to them fails
+ *              right away without formatting anything, which is the
+ *              fastest way to run the game silently. Reading from it
+ *              always fails, so it is meant for games that don't
+ *              prompt, such as scripted games.
+*********************************************************************/
+
+
+#ifndef NULL_IO_HPP
+#define NULL_IO_HPP
+
+#include "IOBackend.hpp"
+
+class NullIO : public IOBackend
+{
+private:
+    std::istream source;
+    std::ostream sink;
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Creates streams with no buffer.
+     *              A stream without a buffer stays bad even when it is
+     *              cleared, so every read and write fails.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    NullIO();
+
+
+    /********************************************************************
+    ** Function: input: Returns an input stream that never has any
+     *              input.
+    ** Params:   None
+    ** Returns:  istream &: input stream.
+    *********************************************************************/
+    virtual std::istream &input() override;
+
+
+    /********************************************************************
+    ** Function: output: Returns an output stream that discards
+     *              everything.
+    ** Params:   None
+    ** Returns:  ostream &: output stream.
+    *********************************************************************/
+    virtual std::ostream &output() override;
+
+};
+
+#endif
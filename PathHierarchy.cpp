@@ -0,0 +1,1500 @@
+/*********************************************************************
+** Program name: PathHierarchy.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 26, 2019 at 2:30 PM
+** Description: Class implementation file for PathHierarchy.
+ *              PathHierarchy plans long trips across very large
+ *              asteroids. The board is split into square clusters.
+ *              Where two clusters touch, every run of cells that can
+ *              be crossed gets an entrance, and the oxygen between
+ *              each pair of entrances of a cluster is worked out
+ *              ahead of time. Only the links that don't just pass
+ *              through another entrance of the cluster at the same
+ *              cost are kept. A trip is then planned on the small
+ *              graph of entrances instead of the tiles, and only the
+ *              leg being walked is turned back into tiles, one
+ *              cluster at a time. Clusters are grouped again into
+ *              square regions. Of the entrances facing each other
+ *              across a region border and joining the same two
+ *              parts of their clusters, one pair are gates, and the
+ *              oxygen between the gates of a region is worked out
+ *              over its entrances. A trip crosses a region holding
+ *              neither of its ends from gate to gate, and walks
+ *              that leg over the tiles of the region, which can
+ *              only be cheaper. Entrances are grouped into the
+ *              parts of the board that can reach each other, so a
+ *              trip to a cell that can't be reached is turned down
+ *              without searching the whole graph. A trip between
+ *              cells in the same or neighboring clusters is also
+ *              searched over the tiles of those clusters, so it is
+ *              never worse than the cheapest one staying inside them.
+ *              Longer trips have to pass through entrances and have
+ *              no fixed bound on how much more oxygen they cost than
+ *              the cheapest one. Stepping
+ *              onto a cell costs the oxygen of its space type, as in
+ *              CostField, and blocked cells can't be crossed. When
+ *              tiles change, only the clusters they are in, and the
+ *              ones across a border they are on, are worked out
+ *              again, with the regions of those clusters. It
+ *              listens to the board like TravelGraph.
+*********************************************************************/
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include "PathHierarchy.hpp"
+#include "Board.hpp"
+
+//initialize distance constants
+const int PathHierarchy::UNREACHABLE = -1;
+const int PathHierarchy::FAR = 1 << 30;
+
+/********************************************************************
+** Function: Constructor: Creates a hierarchy for a board where
+ *              every cell costs 1.
+** Params:   int rows: number of rows of the board.
+ *           int cols: number of columns of the board.
+** Returns:  None
+*********************************************************************/
+PathHierarchy::PathHierarchy(int rows, int cols)
+        : rows(0), cols(0), cluster_rows(0), cluster_cols(0),
+          region_rows(0), region_cols(0), stamp(0),
+          area_left(0), area_top(0), area_width(0)
+{
+    resize(rows, cols);
+}
+
+
+/********************************************************************
+** Function: resize: Sets the size of the board. Every cell costs 1
+ *              again.
+** Params:   int rows: number of rows of the board.
+ *           int cols: number of columns of the board.
+** Returns:  None
+*********************************************************************/
+void PathHierarchy::resize(int rows, int cols)
+{
+    this->rows = rows;
+    this->cols = cols;
+    cluster_rows = (rows + CLUSTER - 1) / CLUSTER;
+    cluster_cols = (cols + CLUSTER - 1) / CLUSTER;
+    region_rows = (cluster_rows + REGION - 1) / REGION;
+    region_cols = (cluster_cols + REGION - 1) / REGION;
+
+    costs.assign(static_cast<std::size_t>(rows) * cols, 1);
+    clusters.assign(cluster_rows * cluster_cols, Cluster());
+    regions.assign(region_rows * region_cols, Region());
+
+    //the widest search is over one region
+    int area = std::min(rows, REGION * CLUSTER) * std::min(cols, REGION * CLUSTER);
+    local_distances.assign(area, FAR);
+    local_parents.assign(area, -1);
+
+    node_cells.clear();
+    node_clusters.clear();
+    node_places.clear();
+    node_exits.clear();
+    node_across.clear();
+    node_groups.clear();
+    components.clear();
+    node_gates.clear();
+    free_ids.clear();
+    waypoints.clear();
+    leg_regions.clear();
+
+    //every cluster has to be worked out, and with them every region
+    dirty.clear();
+    for (int i=0; i<cluster_rows * cluster_cols; i++)
+    {
+        clusters[i].dirty = false;
+        markDirty(i);
+    }
+    dirty_regions.clear();
+    for (int i=0; i<region_rows * region_cols; i++)
+    {
+        regions[i].dirty = false;
+    }
+}
+
+
+/********************************************************************
+** Function: clusterOf: Returns the cluster a cell is in.
+** Params:   int cell: cell, as y * cols + x.
+** Returns:  int: index of the cluster.
+*********************************************************************/
+int PathHierarchy::clusterOf(int cell) const
+{
+    return (cell / cols / CLUSTER) * cluster_cols + (cell % cols) / CLUSTER;
+}
+
+
+/********************************************************************
+** Function: regionOf: Returns the region a cluster is in.
+** Params:   int cluster: index of the cluster.
+** Returns:  int: index of the region.
+*********************************************************************/
+int PathHierarchy::regionOf(int cluster) const
+{
+    return (cluster / cluster_cols / REGION) * region_cols + (cluster % cluster_cols) / REGION;
+}
+
+
+/********************************************************************
+** Function: markDirty: Marks a cluster to be worked out again.
+** Params:   int cluster: index of the cluster.
+** Returns:  None
+*********************************************************************/
+void PathHierarchy::markDirty(int cluster)
+{
+    if (!clusters[cluster].dirty)
+    {
+        clusters[cluster].dirty = true;
+        dirty.push_back(cluster);
+    }
+}
+
+
+/********************************************************************
+** Function: setCost: Sets the oxygen it takes to step onto a cell.
+ *              The clusters it affects are worked out again
+ *              before the next trip is planned.
+** Params:   int x: x-coordinate.
+ *           int y: y-coordinate.
+ *           int cost: oxygen cost, 0 or less blocks the cell.
+** Returns:  None
+*********************************************************************/
+void PathHierarchy::setCost(int x, int y, int cost)
+{
+    if (cost < 0)
+    {
+        cost = 0;
+    }
+    else if (cost > CostField::MAX_COST)
+    {
+        cost = CostField::MAX_COST;
+    }
+
+    int cell = y * cols + x;
+    if (costs[cell] == cost)
+    {
+        return;
+    }
+    costs[cell] = static_cast<unsigned char>(cost);
+
+    int cluster = clusterOf(cell);
+    markDirty(cluster);
+
+    //a cell on a border also changes the entrances across it
+    if (x % CLUSTER == 0 && x > 0)
+    {
+        markDirty(cluster - 1);
+    }
+    if (x % CLUSTER == CLUSTER - 1 && x + 1 < cols)
+    {
+        markDirty(cluster + 1);
+    }
+    if (y % CLUSTER == 0 && y > 0)
+    {
+        markDirty(cluster - cluster_cols);
+    }
+    if (y % CLUSTER == CLUSTER - 1 && y + 1 < rows)
+    {
+        markDirty(cluster + cluster_cols);
+    }
+}
+
+
+/********************************************************************
+** Function: setCosts: Sets the cost of the cells in a rectangle
+ *              from the oxygen cost of their space type. Empty
+ *              cells and chasms can't be walked on.
+** Params:   const Board &board: board of the same size.
+ *           int left: x-coordinate of the first column.
+ *           int top: y-coordinate of the first row.
+ *           int right: x-coordinate of the last column.
+ *           int bottom: y-coordinate of the last row.
+** Returns:  None
+*********************************************************************/
+void PathHierarchy::setCosts(const Board &board, int left, int top, int right, int bottom)
+{
+    for (int y=top; y<=bottom; y++)
+    {
+        for (int x=left; x<=right; x++)
+        {
+            SpaceType type = board.getType(x, y);
+            setCost(x, y, SPACE_CONFIG_LT[type].passable ? SPACE_CONFIG_LT[type].oxygen_cost : 0);
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: markRegion: Marks a region to be worked out again.
+** Params:   int region: index of the region.
+** Returns:  None
+*********************************************************************/
+void PathHierarchy::markRegion(int region)
+{
+    if (!regions[region].dirty)
+    {
+        regions[region].dirty = true;
+        dirty_regions.push_back(region);
+    }
+}
+
+
+/********************************************************************
+** Function: update: Works out the clusters affected by changed
+ *              costs, then groups the entrances again and works
+ *              out the regions of those clusters.
+** Params:   None
+** Returns:  int: number of clusters worked out.
+*********************************************************************/
+int PathHierarchy::update()
+{
+    int count = static_cast<int>(dirty.size());
+
+    bool regroup = false;
+
+    for (int i=0; i<count; i++)
+    {
+        int cluster = dirty[i];
+        if (rebuildCluster(cluster))
+        {
+            regroup = true;
+        }
+        clusters[cluster].dirty = false;
+
+        //its region links through it, and the gates of a region across
+        // a border it is on face its entrances
+        int col = cluster % cluster_cols;
+        int row = cluster / cluster_cols;
+        markRegion(regionOf(cluster));
+        if (col > 0)
+        {
+            markRegion(regionOf(cluster - 1));
+        }
+        if (col + 1 < cluster_cols)
+        {
+            markRegion(regionOf(cluster + 1));
+        }
+        if (row > 0)
+        {
+            markRegion(regionOf(cluster - cluster_cols));
+        }
+        if (row + 1 < cluster_rows)
+        {
+            markRegion(regionOf(cluster + cluster_cols));
+        }
+    }
+    dirty.clear();
+
+    //a cluster that changed shape can join or split parts of the board
+    if (regroup)
+    {
+        groupComponents();
+    }
+
+    for (std::size_t i=0; i<dirty_regions.size(); i++)
+    {
+        rebuildRegion(dirty_regions[i]);
+        regions[dirty_regions[i]].dirty = false;
+    }
+    dirty_regions.clear();
+
+    //planning state grows with the entrances, here rather than in the
+    // first plan after
+    if (visits.size() < node_cells.size())
+    {
+        Visit unseen = {FAR, -1, 0, 0};
+        visits.resize(node_cells.size(), unseen);
+    }
+
+    return count;
+}
+
+
+/********************************************************************
+** Function: tilesChanged: Updates the costs of the cells that
+ *              changed and works out their clusters again.
+** Params:   const Board &board: the board that changed.
+ *           int left: x-coordinate of the first changed column.
+ *           int top: y-coordinate of the first changed row.
+ *           int right: x-coordinate of the last changed column.
+ *           int bottom: y-coordinate of the last changed row.
+** Returns:  None
+*********************************************************************/
+void PathHierarchy::tilesChanged(const Board &board, int left, int top,
+                                 int right, int bottom)
+{
+    setCosts(board, left, top, right, bottom);
+    update();
+}
+
+
+/********************************************************************
+** Function: addEntrance: Adds an entrance to a cluster, or another
+ *              way out to one already on the same cell.
+** Params:   int cluster: index of the cluster.
+ *           int cell: cell of the entrance.
+ *           int exit: cell across the border it leads to.
+** Returns:  None
+*********************************************************************/
+void PathHierarchy::addEntrance(int cluster, int cell, int exit)
+{
+    std::vector<int> &ids = clusters[cluster].ids;
+
+    //a corner cell can lead out two ways
+    for (std::size_t i=0; i<ids.size(); i++)
+    {
+        if (node_cells[ids[i]] == cell)
+        {
+            node_exits[2 * ids[i] + 1] = exit;
+            return;
+        }
+    }
+
+    int id = 0;
+    if (!free_ids.empty())
+    {
+        id = free_ids.back();
+        free_ids.pop_back();
+    }
+    else
+    {
+        id = static_cast<int>(node_cells.size());
+        node_cells.push_back(0);
+        node_clusters.push_back(0);
+        node_places.push_back(0);
+        node_exits.push_back(-1);
+        node_exits.push_back(-1);
+        node_across.push_back(-1);
+        node_across.push_back(-1);
+        node_groups.push_back(0);
+        components.push_back(0);
+        node_gates.push_back(-1);
+    }
+
+    node_cells[id] = cell;
+    node_clusters[id] = cluster;
+    node_places[id] = static_cast<int>(ids.size());
+    node_exits[2 * id] = exit;
+    node_exits[2 * id + 1] = -1;
+    ids.push_back(id);
+}
+
+
+/********************************************************************
+** Function: addBorder: Adds the entrances on one side of a cluster.
+ *              Both clusters of a border find the same runs, so
+ *              their entrances always face each other.
+** Params:   int cluster: index of the cluster.
+ *           int first: first cell of the cluster along the side.
+ *           int step: cells between two cells along the side.
+ *           int across: cells from a cell to the one across the
+ *              border.
+ *           int length: number of cells along the side.
+** Returns:  None
+*********************************************************************/
+void PathHierarchy::addBorder(int cluster, int first, int step, int across, int length)
+{
+    int run_start = -1;
+
+    //one past the end closes the last run
+    for (int i=0; i<=length; i++)
+    {
+        int cell = first + i * step;
+        bool open = (i < length) && costs[cell] && costs[cell + across];
+
+        if (open && run_start < 0)
+        {
+            run_start = i;
+        }
+        else if (!open && run_start >= 0)
+        {
+            int run_end = i - 1;
+
+            if (run_end - run_start + 1 >= LONG_RUN)
+            {
+                addEntrance(cluster, first + run_start * step, first + run_start * step + across);
+                addEntrance(cluster, first + run_end * step, first + run_end * step + across);
+            }
+            else
+            {
+                int middle = first + ((run_start + run_end) / 2) * step;
+                addEntrance(cluster, middle, middle + across);
+            }
+            run_start = -1;
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: rebuildCluster: Works out the entrances of a cluster
+ *              and the oxygen between each pair of them. If the
+ *              entrances and the ones each can reach inside the
+ *              cluster stay the same, they keep their groups.
+** Params:   int cluster: index of the cluster.
+** Returns:  bool: true if the entrances have to be grouped again.
+*********************************************************************/
+bool PathHierarchy::rebuildCluster(int cluster)
+{
+    Cluster &square = clusters[cluster];
+
+    old_cells.clear();
+    old_groups.clear();
+    old_components.clear();
+    for (std::size_t i=0; i<square.ids.size(); i++)
+    {
+        int id = square.ids[i];
+        old_cells.push_back(node_cells[id]);
+        old_groups.push_back(node_places[node_groups[id]]);
+        old_components.push_back(components[id]);
+    }
+
+    //give back the old ids
+    free_ids.insert(free_ids.end(), square.ids.begin(), square.ids.end());
+    square.ids.clear();
+
+    int left = (cluster % cluster_cols) * CLUSTER;
+    int top = (cluster / cluster_cols) * CLUSTER;
+    int width = std::min(static_cast<int>(CLUSTER), cols - left);
+    int height = std::min(static_cast<int>(CLUSTER), rows - top);
+    int corner = top * cols + left;
+
+    //top, bottom, left and right sides, if there is a cluster across
+    if (top > 0)
+    {
+        addBorder(cluster, corner, 1, -cols, width);
+    }
+    if (top + height < rows)
+    {
+        addBorder(cluster, corner + (height - 1) * cols, 1, cols, width);
+    }
+    if (left > 0)
+    {
+        addBorder(cluster, corner, cols, -1, height);
+    }
+    if (left + width < cols)
+    {
+        addBorder(cluster, corner + width - 1, cols, 1, height);
+    }
+
+    //match the entrances up with the ones facing them, both ways.
+    // A cluster across that is still waiting to be worked out matches
+    // them again once it is
+    const int COUNT = static_cast<int>(square.ids.size());
+    for (int i=0; i<COUNT; i++)
+    {
+        int id = square.ids[i];
+        for (int k=0; k<2; k++)
+        {
+            int exit = node_exits[2 * id + k];
+            int other = (exit >= 0) ? findEntrance(clusterOf(exit), exit) : -1;
+            node_across[2 * id + k] = other;
+
+            for (int m=0; other>=0 && m<2; m++)
+            {
+                if (node_exits[2 * other + m] == node_cells[id])
+                {
+                    node_across[2 * other + m] = id;
+                }
+            }
+        }
+    }
+
+    //one search from each entrance finds the oxygen to the others
+    paths.assign(COUNT * COUNT, FAR);
+    for (int i=0; i<COUNT; i++)
+    {
+        searchClusters(cluster, cluster, node_cells[square.ids[i]], false);
+        for (int j=0; j<COUNT; j++)
+        {
+            paths[i * COUNT + j] = areaDistance(node_cells[square.ids[j]]);
+        }
+    }
+
+    square.starts.assign(COUNT + 1, 0);
+    square.links.clear();
+    for (int i=0; i<COUNT; i++)
+    {
+        square.starts[i] = static_cast<int>(square.links.size());
+        node_groups[square.ids[i]] = square.ids[i];
+
+        for (int j=0; j<COUNT; j++)
+        {
+            int path = paths[i * COUNT + j];
+            if (j == i || path == FAR)
+            {
+                continue;
+            }
+
+            //cells can be walked both ways, so the first entrance
+            // reached stands for the ones of this part of the cluster
+            if (j < i && node_groups[square.ids[i]] == square.ids[i])
+            {
+                node_groups[square.ids[i]] = square.ids[j];
+            }
+
+            //a link as cheap through another entrance isn't needed,
+            // planning gets there through that entrance
+            bool through = false;
+            for (int k=0; k<COUNT && !through; k++)
+            {
+                through = (k != i && k != j && paths[i * COUNT + k] < path
+                           && paths[i * COUNT + k] + paths[k * COUNT + j] == path);
+            }
+            if (!through)
+            {
+                square.links.push_back(j);
+                square.links.push_back(path);
+            }
+        }
+    }
+    square.starts[COUNT] = static_cast<int>(square.links.size());
+
+    if (static_cast<int>(old_cells.size()) != COUNT)
+    {
+        return true;
+    }
+    for (int i=0; i<COUNT; i++)
+    {
+        int id = square.ids[i];
+        if (node_cells[id] != old_cells[i] || node_places[node_groups[id]] != old_groups[i])
+        {
+            return true;
+        }
+    }
+
+    //same shape, so every entrance stays in its group
+    for (int i=0; i<COUNT; i++)
+    {
+        components[square.ids[i]] = old_components[i];
+    }
+    return false;
+}
+
+
+/********************************************************************
+** Function: addGates: Makes gates of the entrances of a cluster
+ *              facing a cluster of another region. Of the ones
+ *              joining the same two parts of the clusters, only
+ *              the middle one is a gate. Both regions pick the
+ *              same ones, so gates always face each other.
+** Params:   int region: index of the region of the cluster.
+ *           int cluster: index of the cluster.
+ *           int other: index of the cluster across the border.
+** Returns:  None
+*********************************************************************/
+void PathHierarchy::addGates(int region, int cluster, int other)
+{
+    const std::vector<int> &ids = clusters[cluster].ids;
+
+    //a corner entrance can come before the others of the side, so
+    // the pairs are sorted by cell, which is the order along it on
+    // both sides
+    facing.clear();
+    for (std::size_t i=0; i<ids.size(); i++)
+    {
+        int id = ids[i];
+        for (int k=0; k<2; k++)
+        {
+            int exit = node_exits[2 * id + k];
+            int across = node_across[2 * id + k];
+            if (exit < 0 || across < 0 || clusterOf(exit) != other)
+            {
+                continue;
+            }
+
+            std::size_t place = facing.size();
+            facing.push_back(id);
+            facing.push_back(across);
+            while (place > 0 && node_cells[facing[place - 2]] > node_cells[id])
+            {
+                facing[place] = facing[place - 2];
+                facing[place + 1] = facing[place - 1];
+                place -= 2;
+            }
+            facing[place] = id;
+            facing[place + 1] = across;
+        }
+    }
+
+    Region &zone = regions[region];
+    const int COUNT = static_cast<int>(facing.size()) / 2;
+    for (int i=0; i<COUNT; i++)
+    {
+        int group = node_groups[facing[2 * i]];
+        int group_across = node_groups[facing[2 * i + 1]];
+
+        //the first pair joining two parts picks for all of them
+        bool seen = false;
+        int joining = 0;
+        for (int j=0; j<COUNT; j++)
+        {
+            if (node_groups[facing[2 * j]] == group && node_groups[facing[2 * j + 1]] == group_across)
+            {
+                seen = seen || (j < i);
+                joining++;
+            }
+        }
+        if (seen)
+        {
+            continue;
+        }
+
+        int middle = joining / 2;
+        for (int j=i; j<COUNT; j++)
+        {
+            if (node_groups[facing[2 * j]] == group && node_groups[facing[2 * j + 1]] == group_across
+                && middle-- == 0)
+            {
+                //a corner can face two regions
+                int gate = facing[2 * j];
+                if (node_gates[gate] < 0)
+                {
+                    node_gates[gate] = static_cast<int>(zone.gates.size());
+                    zone.gates.push_back(gate);
+                }
+            }
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: rebuildRegion: Works out the gates of a region and the
+ *              oxygen between each pair of them, through the
+ *              entrances of its clusters.
+** Params:   int region: index of the region.
+** Returns:  None
+*********************************************************************/
+void PathHierarchy::rebuildRegion(int region)
+{
+    Region &zone = regions[region];
+
+    int first_col = (region % region_cols) * REGION;
+    int first_row = (region / region_cols) * REGION;
+    int last_col = std::min(first_col + static_cast<int>(REGION), cluster_cols) - 1;
+    int last_row = std::min(first_row + static_cast<int>(REGION), cluster_rows) - 1;
+
+    //ids can have moved between clusters since the region was last
+    // worked out, so every entrance starts out as no gate
+    zone.gates.clear();
+    for (int row=first_row; row<=last_row; row++)
+    {
+        for (int col=first_col; col<=last_col; col++)
+        {
+            const std::vector<int> &ids = clusters[row * cluster_cols + col].ids;
+            for (std::size_t i=0; i<ids.size(); i++)
+            {
+                node_gates[ids[i]] = -1;
+            }
+        }
+    }
+
+    //the clusters along each side with a region across
+    for (int row=first_row; row<=last_row; row++)
+    {
+        for (int col=first_col; col<=last_col; col++)
+        {
+            int cluster = row * cluster_cols + col;
+            if (row == first_row && row > 0)
+            {
+                addGates(region, cluster, cluster - cluster_cols);
+            }
+            if (row == last_row && row + 1 < cluster_rows)
+            {
+                addGates(region, cluster, cluster + cluster_cols);
+            }
+            if (col == first_col && col > 0)
+            {
+                addGates(region, cluster, cluster - 1);
+            }
+            if (col == last_col && col + 1 < cluster_cols)
+            {
+                addGates(region, cluster, cluster + 1);
+            }
+        }
+    }
+
+    //the entrances of the region are numbered from 0, cluster by
+    // cluster, and their links inside the region copied together, so
+    // the searches from the gates don't jump all over the board
+    const int WIDTH = last_col - first_col + 1;
+    int total = 0;
+    int longest = 0;
+    inner_firsts.assign(REGION * REGION, 0);
+    for (int row=first_row; row<=last_row; row++)
+    {
+        for (int col=first_col; col<=last_col; col++)
+        {
+            inner_firsts[(row - first_row) * WIDTH + col - first_col] = total;
+            total += static_cast<int>(clusters[row * cluster_cols + col].ids.size());
+        }
+    }
+
+    inner_starts.assign(total + 1, 0);
+    inner_gates.assign(total, -1);
+    inner_links.clear();
+    for (int row=first_row; row<=last_row; row++)
+    {
+        for (int col=first_col; col<=last_col; col++)
+        {
+            const Cluster &square = clusters[row * cluster_cols + col];
+            int first = inner_firsts[(row - first_row) * WIDTH + col - first_col];
+
+            for (std::size_t place=0; place<square.ids.size(); place++)
+            {
+                int id = square.ids[place];
+                inner_starts[first + place] = static_cast<int>(inner_links.size());
+                inner_gates[first + place] = node_gates[id];
+
+                for (int link=square.starts[place]; link<square.starts[place + 1]; link+=2)
+                {
+                    inner_links.push_back(first + square.links[link]);
+                    inner_links.push_back(square.links[link + 1]);
+                    longest = std::max(longest, square.links[link + 1]);
+                }
+
+                for (int k=0; k<2; k++)
+                {
+                    int other = node_across[2 * id + k];
+                    int other_cluster = (other >= 0) ? node_clusters[other] : -1;
+                    if (other >= 0 && regionOf(other_cluster) == region)
+                    {
+                        int other_row = other_cluster / cluster_cols - first_row;
+                        int other_col = other_cluster % cluster_cols - first_col;
+                        inner_links.push_back(inner_firsts[other_row * WIDTH + other_col] + node_places[other]);
+                        inner_links.push_back(costs[node_exits[2 * id + k]]);
+                        longest = std::max(longest, static_cast<int>(costs[node_exits[2 * id + k]]));
+                    }
+                }
+            }
+        }
+    }
+    inner_starts[total] = static_cast<int>(inner_links.size());
+
+    //one search from each gate finds the oxygen to the others, with a
+    // bucket queue going around as many buckets as the longest link
+    // needs, and stops once it has them all
+    const int COUNT = static_cast<int>(zone.gates.size());
+    const int BUCKETS = longest + 1;
+    if (static_cast<int>(inner_buckets.size()) < BUCKETS)
+    {
+        inner_buckets.resize(BUCKETS);
+    }
+
+    paths.assign(COUNT * COUNT, FAR);
+    for (int i=0; i<COUNT; i++)
+    {
+        int gate = zone.gates[i];
+        int cluster = node_clusters[gate];
+        int from = inner_firsts[(cluster / cluster_cols - first_row) * WIDTH
+                                + cluster % cluster_cols - first_col] + node_places[gate];
+
+        inner_best.assign(total, FAR);
+        inner_best[from] = 0;
+        inner_buckets[0].push_back(from);
+        int waiting = 1;
+        int left = COUNT;
+
+        for (int oxygen=0; waiting > 0 && left > 0; oxygen++)
+        {
+            std::vector<int> &bucket = inner_buckets[oxygen % BUCKETS];
+
+            for (std::size_t b=0; b<bucket.size() && left > 0; b++)
+            {
+                int here = bucket[b];
+                if (inner_best[here] != oxygen)
+                {
+                    continue;
+                }
+
+                if (inner_gates[here] >= 0)
+                {
+                    paths[i * COUNT + inner_gates[here]] = oxygen;
+                    left--;
+                }
+
+                for (int link=inner_starts[here]; link<inner_starts[here + 1]; link+=2)
+                {
+                    int there = inner_links[link];
+                    int total_oxygen = oxygen + inner_links[link + 1];
+                    if (total_oxygen < inner_best[there])
+                    {
+                        inner_best[there] = total_oxygen;
+                        inner_buckets[total_oxygen % BUCKETS].push_back(there);
+                        waiting++;
+                    }
+                }
+            }
+
+            waiting -= static_cast<int>(bucket.size());
+            bucket.clear();
+        }
+
+        //stopping early leaves ways waiting
+        for (int b=0; b<BUCKETS; b++)
+        {
+            inner_buckets[b].clear();
+        }
+    }
+
+    //what planning through the region needs of each gate
+    Visit unseen = {FAR, -1, 0, 0};
+    zone.cells.resize(COUNT);
+    zone.exits.resize(2 * COUNT);
+    zone.across.resize(2 * COUNT);
+    zone.visits.assign(COUNT, unseen);
+    for (int i=0; i<COUNT; i++)
+    {
+        int id = zone.gates[i];
+        zone.cells[i] = node_cells[id];
+        for (int k=0; k<2; k++)
+        {
+            zone.exits[2 * i + k] = node_exits[2 * id + k];
+            zone.across[2 * i + k] = node_across[2 * id + k];
+        }
+    }
+
+    zone.starts.assign(COUNT + 1, 0);
+    zone.links.clear();
+    for (int i=0; i<COUNT; i++)
+    {
+        zone.starts[i] = static_cast<int>(zone.links.size());
+
+        for (int j=0; j<COUNT; j++)
+        {
+            int path = paths[i * COUNT + j];
+            if (j == i || path == FAR)
+            {
+                continue;
+            }
+
+            //as in a cluster, a link as cheap through another gate
+            // isn't needed
+            bool through = false;
+            for (int k=0; k<COUNT && !through; k++)
+            {
+                through = (k != i && k != j && paths[i * COUNT + k] < path
+                           && paths[i * COUNT + k] + paths[k * COUNT + j] == path);
+            }
+            if (!through)
+            {
+                zone.links.push_back(j);
+                zone.links.push_back(path);
+            }
+        }
+    }
+    zone.starts[COUNT] = static_cast<int>(zone.links.size());
+}
+
+
+/********************************************************************
+** Function: findComponent: Returns the entrance standing for every
+ *              entrance an entrance can reach, while grouping.
+** Params:   int id: id of the entrance.
+** Returns:  int: id of the entrance standing for the group.
+*********************************************************************/
+int PathHierarchy::findComponent(int id)
+{
+    //skip every other step on the way up, so the next find is shorter
+    while (components[id] != id)
+    {
+        components[id] = components[components[id]];
+        id = components[id];
+    }
+    return id;
+}
+
+
+/********************************************************************
+** Function: groupComponents: Groups every entrance with the ones
+ *              it can reach, through its cluster and across
+ *              borders.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void PathHierarchy::groupComponents()
+{
+    //ids given back aren't in any cluster, and are left alone
+    for (std::size_t c=0; c<clusters.size(); c++)
+    {
+        for (std::size_t i=0; i<clusters[c].ids.size(); i++)
+        {
+            int id = clusters[c].ids[i];
+            components[id] = id;
+        }
+    }
+
+    for (std::size_t c=0; c<clusters.size(); c++)
+    {
+        for (std::size_t i=0; i<clusters[c].ids.size(); i++)
+        {
+            int id = clusters[c].ids[i];
+            components[findComponent(id)] = findComponent(node_groups[id]);
+
+            for (int k=0; k<2; k++)
+            {
+                int other = node_across[2 * id + k];
+                if (other >= 0)
+                {
+                    components[findComponent(id)] = findComponent(other);
+                }
+            }
+        }
+    }
+
+    //point every entrance straight at the one standing for its group
+    for (std::size_t c=0; c<clusters.size(); c++)
+    {
+        for (std::size_t i=0; i<clusters[c].ids.size(); i++)
+        {
+            int id = clusters[c].ids[i];
+            components[id] = findComponent(id);
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: searchArea: Finds the oxygen between a cell and every
+ *              other cell of a rectangle, without leaving it, with
+ *              a bucket queue like CostField.
+** Params:   int left: x-coordinate of the first column.
+ *           int top: y-coordinate of the first row.
+ *           int width: number of columns.
+ *           int height: number of rows.
+ *           int cell: cell to search from, or to when reversed.
+ *           bool reverse: true to find the oxygen from every
+ *              cell to the given one instead.
+** Returns:  None
+*********************************************************************/
+void PathHierarchy::searchArea(int left, int top, int width, int height, int cell, bool reverse)
+{
+    const int BUCKETS = CostField::MAX_COST + 1;
+
+    area_left = left;
+    area_top = top;
+    area_width = width;
+
+    std::fill(local_distances.begin(), local_distances.begin() + width * height, FAR);
+    for (int i=0; i<BUCKETS; i++)
+    {
+        buckets[i].clear();
+    }
+
+    if (!costs[cell])
+    {
+        return;
+    }
+
+    int start = (cell / cols - top) * width + (cell % cols - left);
+    local_distances[start] = 0;
+    local_parents[start] = -1;
+    buckets[0].push_back(start);
+    int waiting = 1;
+
+    for (int oxygen=0; waiting > 0; oxygen++)
+    {
+        std::vector<int> &bucket = buckets[oxygen % BUCKETS];
+
+        for (std::size_t i=0; i<bucket.size(); i++)
+        {
+            int here = bucket[i];
+            if (local_distances[here] != oxygen)
+            {
+                continue;
+            }
+
+            int x = here % width;
+            int y = here / width;
+            int here_cost = costs[(top + y) * cols + left + x];
+            const int NEIGHBOR_X[] = {x, x + 1, x, x - 1};
+            const int NEIGHBOR_Y[] = {y - 1, y, y + 1, y};
+
+            for (int k=0; k<4; k++)
+            {
+                if (NEIGHBOR_X[k] < 0 || NEIGHBOR_X[k] >= width
+                    || NEIGHBOR_Y[k] < 0 || NEIGHBOR_Y[k] >= height)
+                {
+                    continue;
+                }
+
+                int neighbor_cost = costs[(top + NEIGHBOR_Y[k]) * cols + left + NEIGHBOR_X[k]];
+                if (!neighbor_cost)
+                {
+                    continue;
+                }
+
+                //going backwards, the step onto this cell is what costs
+                int neighbor = NEIGHBOR_Y[k] * width + NEIGHBOR_X[k];
+                int total = oxygen + (reverse ? here_cost : neighbor_cost);
+                if (total < local_distances[neighbor])
+                {
+                    local_distances[neighbor] = total;
+                    local_parents[neighbor] = here;
+                    buckets[total % BUCKETS].push_back(neighbor);
+                    waiting++;
+                }
+            }
+        }
+
+        waiting -= static_cast<int>(bucket.size());
+        bucket.clear();
+    }
+}
+
+
+/********************************************************************
+** Function: searchClusters: Searches the rectangle covering two
+ *              clusters, from or to a cell of one of them.
+** Params:   int first: index of one cluster.
+ *           int second: index of the other, the same for one.
+ *           int cell: cell to search from, or to when reversed.
+ *           bool reverse: true to search to the cell.
+** Returns:  None
+*********************************************************************/
+void PathHierarchy::searchClusters(int first, int second, int cell, bool reverse)
+{
+    int left = std::min(first % cluster_cols, second % cluster_cols) * CLUSTER;
+    int top = std::min(first / cluster_cols, second / cluster_cols) * CLUSTER;
+    int right = std::min((std::max(first % cluster_cols, second % cluster_cols) + 1) * CLUSTER, cols);
+    int bottom = std::min((std::max(first / cluster_cols, second / cluster_cols) + 1) * CLUSTER, rows);
+
+    searchArea(left, top, right - left, bottom - top, cell, reverse);
+}
+
+
+/********************************************************************
+** Function: areaDistance: Returns the oxygen of a cell found by
+ *              the last search.
+** Params:   int cell: cell of the rectangle that was searched.
+** Returns:  int: oxygen, or FAR.
+*********************************************************************/
+int PathHierarchy::areaDistance(int cell) const
+{
+    return local_distances[(cell / cols - area_top) * area_width + (cell % cols - area_left)];
+}
+
+
+/********************************************************************
+** Function: followParents: Adds the cells of the way found by the
+ *              last search to a cell, not counting the first.
+** Params:   int cell: cell of the rectangle that was searched.
+ *           vector<int> &cells: the cells are added to the end.
+** Returns:  None
+*********************************************************************/
+void PathHierarchy::followParents(int cell, std::vector<int> &cells) const
+{
+    std::size_t first = cells.size();
+    for (int local=(cell / cols - area_top) * area_width + (cell % cols - area_left);
+         local_parents[local] != -1; local=local_parents[local])
+    {
+        cells.push_back((area_top + local / area_width) * cols + area_left + local % area_width);
+    }
+    std::reverse(cells.begin() + first, cells.end());
+}
+
+
+/********************************************************************
+** Function: findEntrance: Returns the id of the entrance on a cell.
+** Params:   int cluster: cluster the cell is in.
+ *           int cell: cell of the entrance.
+** Returns:  int: id of the entrance, or -1 if there is none.
+*********************************************************************/
+int PathHierarchy::findEntrance(int cluster, int cell) const
+{
+    const std::vector<int> &ids = clusters[cluster].ids;
+
+    for (std::size_t i=0; i<ids.size(); i++)
+    {
+        if (node_cells[ids[i]] == cell)
+        {
+            return ids[i];
+        }
+    }
+    return -1;
+}
+
+
+/********************************************************************
+** Function: visitOf: Returns the planning state of an entrance in
+ *              the current plan.
+** Params:   int id: id of the entrance.
+ *           int start_region: region of the start.
+ *           int goal_region: region of the goal.
+** Returns:  Visit &: its state, kept with its region's gates if
+ *              the region holds neither end.
+*********************************************************************/
+PathHierarchy::Visit &PathHierarchy::visitOf(int id, int start_region, int goal_region)
+{
+    int region = regionOf(node_clusters[id]);
+    if (region == start_region || region == goal_region)
+    {
+        return visits[id];
+    }
+    return regions[region].visits[node_gates[id]];
+}
+
+
+/********************************************************************
+** Function: reach: Records a cheaper way to an entrance, or to a
+ *              gate of a region holding neither end, and puts it
+ *              on the planning heap.
+** Params:   int id: entrance reached, or place of the gate.
+ *           int region: region of the gate, -1 for an entrance.
+ *           int oxygen: oxygen to get there.
+ *           int parent: entrance it was reached from, -1 for the
+ *              start.
+ *           int goal: goal cell, to estimate what is left.
+** Returns:  None
+*********************************************************************/
+void PathHierarchy::reach(int id, int region, int oxygen, int parent, int goal)
+{
+    Visit &visit = (region < 0) ? visits[id] : regions[region].visits[id];
+    if (visit.stamp != stamp)
+    {
+        visit.stamp = stamp;
+        visit.best = FAR;
+        visit.closed = 0;
+    }
+
+    //the estimate is weighted, so a closed entrance can turn out to
+    // be cheaper later, but its neighbors were already reached from
+    // it and stay as they are
+    if (visit.closed || oxygen >= visit.best)
+    {
+        return;
+    }
+    visit.best = oxygen;
+    visit.parent = parent;
+
+    //the distance left, weighted a little over the cheapest step
+    int cell = (region < 0) ? node_cells[id] : regions[region].cells[id];
+    Open open;
+    open.estimate = oxygen + (std::abs(cell % cols - goal % cols)
+                              + std::abs(cell / cols - goal / cols)) * ESTIMATE_PERCENT / 100;
+    open.oxygen = oxygen;
+    open.id = id;
+    open.region = region;
+    heap.push_back(open);
+    std::push_heap(heap.begin(), heap.end(), std::greater<Open>());
+}
+
+
+/********************************************************************
+** Function: plan: Plans a trip between two cells through the
+ *              entrances of the clusters on the way. Clusters
+ *              waiting to be worked out are updated first.
+** Params:   int from_x: x-coordinate to start at.
+ *           int from_y: y-coordinate to start at.
+ *           int to_x: x-coordinate to get to.
+ *           int to_y: y-coordinate to get to.
+** Returns:  int: oxygen of the trip as planned, or UNREACHABLE.
+ *              Walking it costs no more while the tiles stay
+ *              the same.
+*********************************************************************/
+int PathHierarchy::plan(int from_x, int from_y, int to_x, int to_y)
+{
+    update();
+
+    waypoints.clear();
+    leg_regions.clear();
+
+    if (from_x < 0 || from_x >= cols || from_y < 0 || from_y >= rows
+        || to_x < 0 || to_x >= cols || to_y < 0 || to_y >= rows)
+    {
+        return UNREACHABLE;
+    }
+
+    int start = from_y * cols + from_x;
+    int goal = to_y * cols + to_x;
+    if (!costs[start] || !costs[goal])
+    {
+        return UNREACHABLE;
+    }
+
+    int start_cluster = clusterOf(start);
+    int goal_cluster = clusterOf(goal);
+    int start_region = regionOf(start_cluster);
+    int goal_region = regionOf(goal_cluster);
+    const std::vector<int> &goal_ids = clusters[goal_cluster].ids;
+    const std::vector<int> &start_ids = clusters[start_cluster].ids;
+
+    //a short trip might go around an entrance's detour, so the tiles
+    // of the start's and goal's clusters are searched as well when
+    // they are the same or touch. Planning has to beat that
+    int found = FAR;
+    int last = -1;
+    if (std::abs(start_cluster % cluster_cols - goal_cluster % cluster_cols) <= 1
+        && std::abs(start_cluster / cluster_cols - goal_cluster / cluster_cols) <= 1)
+    {
+        searchClusters(start_cluster, goal_cluster, start, false);
+        found = areaDistance(goal);
+    }
+
+    //oxygen from each entrance of the goal's cluster to the goal
+    searchClusters(goal_cluster, goal_cluster, goal, true);
+    to_goal.resize(goal_ids.size());
+    for (std::size_t i=0; i<goal_ids.size(); i++)
+    {
+        to_goal[i] = areaDistance(node_cells[goal_ids[i]]);
+    }
+
+    //the entrances of the start's cluster are where planning begins
+    searchClusters(start_cluster, start_cluster, start, false);
+    from_start.resize(start_ids.size());
+    for (std::size_t i=0; i<start_ids.size(); i++)
+    {
+        from_start[i] = areaDistance(node_cells[start_ids[i]]);
+    }
+
+    //without a way inside the cluster, the start has to leave it
+    // through an entrance in the same part of the board as one
+    // leading to the goal
+    bool connected = (found < FAR);
+    for (std::size_t i=0; i<start_ids.size() && !connected; i++)
+    {
+        for (std::size_t j=0; j<goal_ids.size() && !connected; j++)
+        {
+            connected = (from_start[i] < FAR && to_goal[j] < FAR
+                         && components[start_ids[i]] == components[goal_ids[j]]);
+        }
+    }
+    if (!connected)
+    {
+        return UNREACHABLE;
+    }
+
+    //a new stamp forgets the last plan
+    if (++stamp == 0)
+    {
+        for (std::size_t i=0; i<visits.size(); i++)
+        {
+            visits[i].stamp = 0;
+        }
+        for (std::size_t r=0; r<regions.size(); r++)
+        {
+            for (std::size_t i=0; i<regions[r].visits.size(); i++)
+            {
+                regions[r].visits[i].stamp = 0;
+            }
+        }
+        stamp = 1;
+    }
+    heap.clear();
+
+    for (std::size_t i=0; i<start_ids.size(); i++)
+    {
+        if (from_start[i] < FAR)
+        {
+            reach(start_ids[i], -1, from_start[i], -1, goal);
+        }
+    }
+
+    //A* over the entrances, until nothing left can beat the best trip
+    while (!heap.empty() && heap.front().estimate < found)
+    {
+        Open next = heap.front();
+        std::pop_heap(heap.begin(), heap.end(), std::greater<Open>());
+        heap.pop_back();
+
+        Visit &visit = (next.region < 0) ? visits[next.id] : regions[next.region].visits[next.id];
+        if (visit.closed)
+        {
+            continue;
+        }
+        visit.closed = 1;
+        int oxygen = visit.best;
+
+        int id = 0;
+        int region = next.region;
+        const int *exits = 0;
+        const int *across = 0;
+
+        if (region < 0)
+        {
+            //an entrance in the start's or goal's region
+            id = next.id;
+            int cluster = node_clusters[id];
+            int place = node_places[id];
+            region = regionOf(cluster);
+
+            if (cluster == goal_cluster && to_goal[place] < FAR && oxygen + to_goal[place] < found)
+            {
+                found = oxygen + to_goal[place];
+                last = id;
+            }
+
+            //other entrances of the same cluster
+            const Cluster &square = clusters[cluster];
+            for (int link=square.starts[place]; link<square.starts[place + 1]; link+=2)
+            {
+                reach(square.ids[square.links[link]], -1, oxygen + square.links[link + 1], id, goal);
+            }
+
+            exits = &node_exits[2 * id];
+            across = &node_across[2 * id];
+        }
+        else
+        {
+            //other gates of a region holding neither end
+            const Region &zone = regions[region];
+            int gate = next.id;
+            id = zone.gates[gate];
+            for (int link=zone.starts[gate]; link<zone.starts[gate + 1]; link+=2)
+            {
+                reach(zone.links[link], region, oxygen + zone.links[link + 1], id, goal);
+            }
+
+            exits = &zone.exits[2 * gate];
+            across = &zone.across[2 * gate];
+        }
+
+        //the entrances across the border. A region holding neither end
+        // is only entered through its gates, and its gate links already
+        // lead everywhere inside it
+        for (int k=0; k<2; k++)
+        {
+            int other = across[k];
+            if (other < 0)
+            {
+                continue;
+            }
+
+            int other_region = regionOf(clusterOf(exits[k]));
+            if (other_region == start_region || other_region == goal_region)
+            {
+                reach(other, -1, oxygen + costs[exits[k]], id, goal);
+            }
+            else if (other_region != region && node_gates[other] >= 0)
+            {
+                reach(node_gates[other], other_region, oxygen + costs[exits[k]], id, goal);
+            }
+        }
+    }
+
+    if (found == FAR)
+    {
+        return UNREACHABLE;
+    }
+
+    //walk back from the goal. Inside a region holding neither end,
+    // every step is a link between two of its gates
+    waypoints.push_back(goal);
+    leg_regions.push_back(-1);
+    for (int id=last; id!=-1; id=visitOf(id, start_region, goal_region).parent)
+    {
+        int parent = visitOf(id, start_region, goal_region).parent;
+        int region = regionOf(node_clusters[id]);
+        bool link = (parent >= 0 && region != start_region && region != goal_region
+                     && regionOf(node_clusters[parent]) == region);
+
+        waypoints.push_back(node_cells[id]);
+        leg_regions.push_back(link ? region : -1);
+    }
+    waypoints.push_back(start);
+    std::reverse(waypoints.begin(), waypoints.end());
+    std::reverse(leg_regions.begin(), leg_regions.end());
+
+    //an entrance on the start or goal is a leg of nothing
+    std::size_t kept = 1;
+    for (std::size_t i=1; i<waypoints.size(); i++)
+    {
+        if (waypoints[i] != waypoints[kept - 1])
+        {
+            waypoints[kept] = waypoints[i];
+            leg_regions[kept - 1] = leg_regions[i - 1];
+            kept++;
+        }
+    }
+    waypoints.resize(kept);
+    leg_regions.resize(kept - 1);
+
+    return found;
+}
+
+
+/********************************************************************
+** Function: legCount: Returns how many legs the last trip has.
+ *              Each leg stays inside one cluster or crosses one
+ *              border, except a trip between neighboring clusters
+ *              that didn't need an entrance, which is one leg.
+** Params:   None
+** Returns:  int: number of legs, 0 if no trip was found.
+*********************************************************************/
+int PathHierarchy::legCount() const
+{
+    return waypoints.empty() ? 0 : static_cast<int>(waypoints.size()) - 1;
+}
+
+
+/********************************************************************
+** Function: refine: Turns one leg of the last trip into the cells
+ *              to walk through, the cheapest way inside the
+ *              cluster, the two clusters, or the region of the
+ *              leg.
+** Params:   int leg: leg to refine, 0 up to legCount.
+ *           vector<int> &cells: the cells of the leg, as
+ *              y * cols + x, are added to the end, not counting
+ *              the cell the leg starts on.
+** Returns:  bool: false if tiles changed since the trip was planned
+ *              and the leg can't be walked any more, nothing is
+ *              added then.
+*********************************************************************/
+bool PathHierarchy::refine(int leg, std::vector<int> &cells)
+{
+    int from = waypoints[leg];
+    int to = waypoints[leg + 1];
+    int from_cluster = clusterOf(from);
+    int to_cluster = clusterOf(to);
+
+    //a border crossing is a single step
+    if (leg_regions[leg] < 0 && from_cluster != to_cluster
+        && std::abs(from % cols - to % cols) + std::abs(from / cols - to / cols) == 1)
+    {
+        if (!costs[to])
+        {
+            return false;
+        }
+        cells.push_back(to);
+        return true;
+    }
+
+    //a link between gates is walked over the tiles of its region,
+    // which can only be cheaper. Anything else stays inside its
+    // cluster, or the two clusters of a short trip
+    int region = leg_regions[leg];
+    if (region >= 0)
+    {
+        int left = (region % region_cols) * REGION * CLUSTER;
+        int top = (region / region_cols) * REGION * CLUSTER;
+        searchArea(left, top, std::min(REGION * CLUSTER, cols - left),
+                   std::min(REGION * CLUSTER, rows - top), from, false);
+    }
+    else
+    {
+        searchClusters(from_cluster, to_cluster, from, false);
+    }
+    if (areaDistance(to) == FAR)
+    {
+        return false;
+    }
+    followParents(to, cells);
+    return true;
+}
+
+
+/********************************************************************
+** Function: entranceCount: Returns how many entrances there are.
+** Params:   None
+** Returns:  int: number of entrances.
+*********************************************************************/
+int PathHierarchy::entranceCount() const
+{
+    return static_cast<int>(node_cells.size() - free_ids.size());
+}
@@ -0,0 +1,565 @@
+/*********************************************************************
+** Program name: PathHierarchy.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 26, 2019 at 2:30 PM
+** Description: Class specification file for PathHierarchy.
+ *              PathHierarchy plans long trips across very large
+ *              asteroids. The board is split into square clusters.
+ *              Where two clusters touch, every run of cells that can
+ *              be crossed gets an entrance, and the oxygen between
+ *              each pair of entrances of a cluster is worked out
+ *              ahead of time. Only the links that don't just pass
+ *              through another entrance of the cluster at the same
+ *              cost are kept. A trip is then planned on the small
+ *              graph of entrances instead of the tiles, and only the
+ *              leg being walked is turned back into tiles, one
+ *              cluster at a time. Clusters are grouped again into
+ *              square regions. Of the entrances facing each other
+ *              across a region border and joining the same two
+ *              parts of their clusters, one pair are gates, and the
+ *              oxygen between the gates of a region is worked out
+ *              over its entrances. A trip crosses a region holding
+ *              neither of its ends from gate to gate, and walks
+ *              that leg over the tiles of the region, which can
+ *              only be cheaper. Entrances are grouped into the
+ *              parts of the board that can reach each other, so a
+ *              trip to a cell that can't be reached is turned down
+ *              without searching the whole graph. A trip between
+ *              cells in the same or neighboring clusters is also
+ *              searched over the tiles of those clusters, so it is
+ *              never worse than the cheapest one staying inside them.
+ *              Longer trips have to pass through entrances and have
+ *              no fixed bound on how much more oxygen they cost than
+ *              the cheapest one. Stepping
+ *              onto a cell costs the oxygen of its space type, as in
+ *              CostField, and blocked cells can't be crossed. When
+ *              tiles change, only the clusters they are in, and the
+ *              ones across a border they are on, are worked out
+ *              again, with the regions of those clusters. It
+ *              listens to the board like TravelGraph.
+*********************************************************************/
+
+
+#ifndef PATH_HIERARCHY_HPP
+#define PATH_HIERARCHY_HPP
+
+#include <vector>
+#include "BoardListener.hpp"
+#include "CostField.hpp"
+
+class PathHierarchy : public BoardListener
+{
+public:
+    //oxygen reported for trips that can't be made
+    static const int UNREACHABLE;
+
+    //width and height of a cluster, in cells
+    enum {CLUSTER = 32};
+
+    //width and height of a region, in clusters. Trips through a
+    // region that holds neither end are planned on its gates only
+    enum {REGION = 8};
+
+    //runs of crossable border cells at least this long get an
+    // entrance at each end instead of one in the middle
+    enum {LONG_RUN = 6};
+
+    //the oxygen left to the goal is estimated at this percent of the
+    // distance, a little over the cheapest a cell can cost, so trips
+    // head for the goal instead of trying every route that looks
+    // as cheap. Trips can cost up to this much more than the cheapest
+    // route through the entrances, which can itself cost more than
+    // the cheapest one over the tiles
+    enum {ESTIMATE_PERCENT = 125};
+
+private:
+    //stored oxygen of cells and entrances that haven't been reached
+    static const int FAR;
+
+    //one square of the board
+    struct Cluster
+    {
+        //entrances of the cluster, by id
+        std::vector<int> ids;
+
+        //links from each entrance to others of the cluster, as pairs
+        // of the other's place and the oxygen to get there. The links
+        // of the entrance at place i start at starts[i] and end at
+        // starts[i + 1]
+        std::vector<int> starts;
+        std::vector<int> links;
+
+        //true if it has to be worked out again
+        bool dirty;
+    };
+
+    //planning state of an entrance, only valid when its stamp matches
+    // the current plan. Kept together, since planning jumps between
+    // entrances all over the board
+    struct Visit
+    {
+        int best;
+        int parent;
+        unsigned int stamp;
+        int closed;
+    };
+
+    //a square of clusters
+    struct Region
+    {
+        //entrances of its clusters facing one in another region, by
+        // id, that trips crossing the region go through
+        std::vector<int> gates;
+
+        //links from each gate to others of the region, as pairs of the
+        // other's place and the oxygen to get there, like a cluster's
+        std::vector<int> starts;
+        std::vector<int> links;
+
+        //for each gate: its cell, and the cells and entrances across
+        // its two ways out, -1 for none. Kept with the region, like the
+        // planning state of the gates when a trip crosses it, so
+        // planning through it stays in one place
+        std::vector<int> cells;
+        std::vector<int> exits;
+        std::vector<int> across;
+        std::vector<Visit> visits;
+
+        //true if it has to be worked out again
+        bool dirty;
+    };
+
+    //an entrance waiting in the planning heap, ties go to the one
+    // furthest along
+    struct Open
+    {
+        int estimate;
+        int oxygen;
+
+        //id of the entrance, or place of the gate in its region
+        int id;
+
+        //region the gate is in, -1 for an entrance
+        int region;
+
+        bool operator>(const Open &other) const
+        {
+            return estimate > other.estimate
+                   || (estimate == other.estimate && oxygen < other.oxygen);
+        }
+    };
+
+    int rows;
+    int cols;
+    int cluster_rows;
+    int cluster_cols;
+    int region_rows;
+    int region_cols;
+
+    //oxygen to step onto each cell, 0 for blocked cells
+    std::vector<unsigned char> costs;
+
+    std::vector<Cluster> clusters;
+
+    //clusters waiting to be worked out again
+    std::vector<int> dirty;
+
+    //regions, and the ones waiting to be worked out again
+    std::vector<Region> regions;
+    std::vector<int> dirty_regions;
+
+    //for each entrance id: its cell, its cluster, its place in the
+    // cluster's list, and the cells across the border it leads to
+    // and the entrances on them, two per id since a corner cell can
+    // lead out two ways
+    std::vector<int> node_cells;
+    std::vector<int> node_clusters;
+    std::vector<int> node_places;
+    std::vector<int> node_exits;
+    std::vector<int> node_across;
+
+    //for each entrance id: the first entrance of its cluster it can
+    // reach without leaving, and the entrance standing for every one
+    // it can reach at all
+    std::vector<int> node_groups;
+    std::vector<int> components;
+
+    //for each entrance id: its place in its region's gates, -1 if it
+    // isn't one
+    std::vector<int> node_gates;
+
+    //oxygen from each entrance to each entrance of the cluster being
+    // worked out, or each gate to each gate of the region, FAR for
+    // none
+    std::vector<int> paths;
+
+    //the entrances of the region being worked out, numbered from 0
+    // cluster by cluster: the first number of each cluster, the links
+    // of each entrance inside the region, laid out like a cluster's,
+    // its place in the gates or -1, the oxygen found to each, and the
+    // ones waiting, by oxygen
+    std::vector<int> inner_firsts;
+    std::vector<int> inner_starts;
+    std::vector<int> inner_links;
+    std::vector<int> inner_gates;
+    std::vector<int> inner_best;
+    std::vector<std::vector<int> > inner_buckets;
+
+    //entrances facing another cluster across a region border, as
+    // pairs of the entrance and the one it faces, in order along it
+    std::vector<int> facing;
+
+    //the entrances of the cluster being worked out as they were
+    // before, by place: cell, place of its first reachable entrance,
+    // and group
+    std::vector<int> old_cells;
+    std::vector<int> old_groups;
+    std::vector<int> old_components;
+
+    //ids given back by clusters that were worked out again
+    std::vector<int> free_ids;
+
+    std::vector<Visit> visits;
+    unsigned int stamp;
+    std::vector<Open> heap;
+
+    //cells of the last trip planned: start, entrances, goal
+    std::vector<int> waypoints;
+
+    //for each leg of the last trip: the region it crosses on a link
+    // between two gates, -1 for the others
+    std::vector<int> leg_regions;
+
+    //search within a rectangle of the board, by cell of the rectangle
+    int area_left;
+    int area_top;
+    int area_width;
+    std::vector<int> local_distances;
+    std::vector<int> local_parents;
+    std::vector<int> buckets[CostField::MAX_COST + 1];
+
+    //oxygen from the start to each entrance of its cluster, and from
+    // each entrance of the goal's cluster to the goal
+    std::vector<int> from_start;
+    std::vector<int> to_goal;
+
+
+    /********************************************************************
+    ** Function: clusterOf: Returns the cluster a cell is in.
+    ** Params:   int cell: cell, as y * cols + x.
+    ** Returns:  int: index of the cluster.
+    *********************************************************************/
+    int clusterOf(int cell) const;
+
+
+    /********************************************************************
+    ** Function: regionOf: Returns the region a cluster is in.
+    ** Params:   int cluster: index of the cluster.
+    ** Returns:  int: index of the region.
+    *********************************************************************/
+    int regionOf(int cluster) const;
+
+
+    /********************************************************************
+    ** Function: markDirty: Marks a cluster to be worked out again.
+    ** Params:   int cluster: index of the cluster.
+    ** Returns:  None
+    *********************************************************************/
+    void markDirty(int cluster);
+
+
+    /********************************************************************
+    ** Function: addEntrance: Adds an entrance to a cluster, or another
+     *              way out to one already on the same cell.
+    ** Params:   int cluster: index of the cluster.
+     *           int cell: cell of the entrance.
+     *           int exit: cell across the border it leads to.
+    ** Returns:  None
+    *********************************************************************/
+    void addEntrance(int cluster, int cell, int exit);
+
+
+    /********************************************************************
+    ** Function: addBorder: Adds the entrances on one side of a cluster.
+     *              Both clusters of a border find the same runs, so
+     *              their entrances always face each other.
+    ** Params:   int cluster: index of the cluster.
+     *           int first: first cell of the cluster along the side.
+     *           int step: cells between two cells along the side.
+     *           int across: cells from a cell to the one across the
+     *              border.
+     *           int length: number of cells along the side.
+    ** Returns:  None
+    *********************************************************************/
+    void addBorder(int cluster, int first, int step, int across, int length);
+
+
+    /********************************************************************
+    ** Function: rebuildCluster: Works out the entrances of a cluster
+     *              and the oxygen between each pair of them. If the
+     *              entrances and the ones each can reach inside the
+     *              cluster stay the same, they keep their groups.
+    ** Params:   int cluster: index of the cluster.
+    ** Returns:  bool: true if the entrances have to be grouped again.
+    *********************************************************************/
+    bool rebuildCluster(int cluster);
+
+
+    /********************************************************************
+    ** Function: markRegion: Marks a region to be worked out again.
+    ** Params:   int region: index of the region.
+    ** Returns:  None
+    *********************************************************************/
+    void markRegion(int region);
+
+
+    /********************************************************************
+    ** Function: addGates: Makes gates of the entrances of a cluster
+     *              facing a cluster of another region. Of the ones
+     *              joining the same two parts of the clusters, only
+     *              the middle one is a gate. Both regions pick the
+     *              same ones, so gates always face each other.
+    ** Params:   int region: index of the region of the cluster.
+     *           int cluster: index of the cluster.
+     *           int other: index of the cluster across the border.
+    ** Returns:  None
+    *********************************************************************/
+    void addGates(int region, int cluster, int other);
+
+
+    /********************************************************************
+    ** Function: rebuildRegion: Works out the gates of a region and the
+     *              oxygen between each pair of them, through the
+     *              entrances of its clusters.
+    ** Params:   int region: index of the region.
+    ** Returns:  None
+    *********************************************************************/
+    void rebuildRegion(int region);
+
+
+    /********************************************************************
+    ** Function: findComponent: Returns the entrance standing for every
+     *              entrance an entrance can reach, while grouping.
+    ** Params:   int id: id of the entrance.
+    ** Returns:  int: id of the entrance standing for the group.
+    *********************************************************************/
+    int findComponent(int id);
+
+
+    /********************************************************************
+    ** Function: groupComponents: Groups every entrance with the ones
+     *              it can reach, through its cluster and across
+     *              borders.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void groupComponents();
+
+
+    /********************************************************************
+    ** Function: searchArea: Finds the oxygen between a cell and every
+     *              other cell of a rectangle, without leaving it, with
+     *              a bucket queue like CostField.
+    ** Params:   int left: x-coordinate of the first column.
+     *           int top: y-coordinate of the first row.
+     *           int width: number of columns.
+     *           int height: number of rows.
+     *           int cell: cell to search from, or to when reversed.
+     *           bool reverse: true to find the oxygen from every
+     *              cell to the given one instead.
+    ** Returns:  None
+    *********************************************************************/
+    void searchArea(int left, int top, int width, int height, int cell, bool reverse);
+
+
+    /********************************************************************
+    ** Function: searchClusters: Searches the rectangle covering two
+     *              clusters, from or to a cell of one of them.
+    ** Params:   int first: index of one cluster.
+     *           int second: index of the other, the same for one.
+     *           int cell: cell to search from, or to when reversed.
+     *           bool reverse: true to search to the cell.
+    ** Returns:  None
+    *********************************************************************/
+    void searchClusters(int first, int second, int cell, bool reverse);
+
+
+    /********************************************************************
+    ** Function: areaDistance: Returns the oxygen of a cell found by
+     *              the last search.
+    ** Params:   int cell: cell of the rectangle that was searched.
+    ** Returns:  int: oxygen, or FAR.
+    *********************************************************************/
+    int areaDistance(int cell) const;
+
+
+    /********************************************************************
+    ** Function: followParents: Adds the cells of the way found by the
+     *              last search to a cell, not counting the first.
+    ** Params:   int cell: cell of the rectangle that was searched.
+     *           vector<int> &cells: the cells are added to the end.
+    ** Returns:  None
+    *********************************************************************/
+    void followParents(int cell, std::vector<int> &cells) const;
+
+
+    /********************************************************************
+    ** Function: findEntrance: Returns the id of the entrance on a cell.
+    ** Params:   int cluster: cluster the cell is in.
+     *           int cell: cell of the entrance.
+    ** Returns:  int: id of the entrance, or -1 if there is none.
+    *********************************************************************/
+    int findEntrance(int cluster, int cell) const;
+
+
+    /********************************************************************
+    ** Function: visitOf: Returns the planning state of an entrance in
+     *              the current plan.
+    ** Params:   int id: id of the entrance.
+     *           int start_region: region of the start.
+     *           int goal_region: region of the goal.
+    ** Returns:  Visit &: its state, kept with its region's gates if
+     *              the region holds neither end.
+    *********************************************************************/
+    Visit &visitOf(int id, int start_region, int goal_region);
+
+
+    /********************************************************************
+    ** Function: reach: Records a cheaper way to an entrance, or to a
+     *              gate of a region holding neither end, and puts it
+     *              on the planning heap.
+    ** Params:   int id: entrance reached, or place of the gate.
+     *           int region: region of the gate, -1 for an entrance.
+     *           int oxygen: oxygen to get there.
+     *           int parent: entrance it was reached from, -1 for the
+     *              start.
+     *           int goal: goal cell, to estimate what is left.
+    ** Returns:  None
+    *********************************************************************/
+    void reach(int id, int region, int oxygen, int parent, int goal);
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor: Creates a hierarchy for a board where
+     *              every cell costs 1.
+    ** Params:   int rows: number of rows of the board.
+     *           int cols: number of columns of the board.
+    ** Returns:  None
+    *********************************************************************/
+    PathHierarchy(int rows, int cols);
+
+
+    /********************************************************************
+    ** Function: resize: Sets the size of the board. Every cell costs 1
+     *              again.
+    ** Params:   int rows: number of rows of the board.
+     *           int cols: number of columns of the board.
+    ** Returns:  None
+    *********************************************************************/
+    void resize(int rows, int cols);
+
+
+    /********************************************************************
+    ** Function: setCost: Sets the oxygen it takes to step onto a cell.
+     *              The clusters it affects are worked out again
+     *              before the next trip is planned.
+    ** Params:   int x: x-coordinate.
+     *           int y: y-coordinate.
+     *           int cost: oxygen cost, 0 or less blocks the cell.
+    ** Returns:  None
+    *********************************************************************/
+    void setCost(int x, int y, int cost);
+
+
+    /********************************************************************
+    ** Function: setCosts: Sets the cost of the cells in a rectangle
+     *              from the oxygen cost of their space type. Empty
+     *              cells and chasms can't be walked on.
+    ** Params:   const Board &board: board of the same size.
+     *           int left: x-coordinate of the first column.
+     *           int top: y-coordinate of the first row.
+     *           int right: x-coordinate of the last column.
+     *           int bottom: y-coordinate of the last row.
+    ** Returns:  None
+    *********************************************************************/
+    void setCosts(const Board &board, int left, int top, int right, int bottom);
+
+
+    /********************************************************************
+    ** Function: update: Works out the clusters affected by changed
+     *              costs, then groups the entrances again and works
+     *              out the regions of those clusters.
+    ** Params:   None
+    ** Returns:  int: number of clusters worked out.
+    *********************************************************************/
+    int update();
+
+
+    /********************************************************************
+    ** Function: tilesChanged: Updates the costs of the cells that
+     *              changed and works out their clusters again.
+    ** Params:   const Board &board: the board that changed.
+     *           int left: x-coordinate of the first changed column.
+     *           int top: y-coordinate of the first changed row.
+     *           int right: x-coordinate of the last changed column.
+     *           int bottom: y-coordinate of the last changed row.
+    ** Returns:  None
+    *********************************************************************/
+    virtual void tilesChanged(const Board &board, int left, int top,
+                              int right, int bottom) override;
+
+
+    /********************************************************************
+    ** Function: plan: Plans a trip between two cells through the
+     *              entrances of the clusters on the way. Clusters
+     *              waiting to be worked out are updated first.
+    ** Params:   int from_x: x-coordinate to start at.
+     *           int from_y: y-coordinate to start at.
+     *           int to_x: x-coordinate to get to.
+     *           int to_y: y-coordinate to get to.
+    ** Returns:  int: oxygen of the trip as planned, or UNREACHABLE.
+     *              Walking it costs no more while the tiles stay
+     *              the same.
+    *********************************************************************/
+    int plan(int from_x, int from_y, int to_x, int to_y);
+
+
+    /********************************************************************
+    ** Function: legCount: Returns how many legs the last trip has.
+     *              Each leg stays inside one cluster, crosses one
+     *              border, or goes between two gates of a region.
+     *              A trip between neighboring clusters that didn't
+     *              need an entrance is one leg.
+    ** Params:   None
+    ** Returns:  int: number of legs, 0 if no trip was found.
+    *********************************************************************/
+    int legCount() const;
+
+
+    /********************************************************************
+    ** Function: refine: Turns one leg of the last trip into the cells
+     *              to walk through, the cheapest way inside the
+     *              cluster, the two clusters, or the region of the
+     *              leg.
+    ** Params:   int leg: leg to refine, 0 up to legCount.
+     *           vector<int> &cells: the cells of the leg, as
+     *              y * cols + x, are added to the end, not counting
+     *              the cell the leg starts on.
+    ** Returns:  bool: false if tiles changed since the trip was planned
+     *              and the leg can't be walked any more, nothing is
+     *              added then.
+    *********************************************************************/
+    bool refine(int leg, std::vector<int> &cells);
+
+
+    /********************************************************************
+    ** Function: entranceCount: Returns how many entrances there are.
+    ** Params:   None
+    ** Returns:  int: number of entrances.
+    *********************************************************************/
+    int entranceCount() const;
+
+};
+
+#endif
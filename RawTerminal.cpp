@@ -0,0 +1,228 @@
+/*********************************************************************
+** Program name: RawTerminal.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 18, 2019 at 3:20 PM
+** Description: Class implementation file for RawTerminal.
+ *              RawTerminal switches the terminal into raw input mode
+ *              so single key presses can be read without waiting for
+ *              enter, and switches it back to normal line input when
+ *              a prompt needs a whole line. Keys are read with poll
+ *              into a small buffer, so keys typed while the game is
+ *              busy drawing are kept until they are read. Arrow key
+ *              escape sequences are decoded into single keys.
+*********************************************************************/
+
+
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <unistd.h>
+#include "RawTerminal.hpp"
+
+//initialize static terminal constants
+const int RawTerminal::ESCAPE_WAIT = 25;
+
+//escape character that starts arrow key sequences
+static const char ESCAPE = 27;
+
+/********************************************************************
+** Function: Constructor/default: Creates a RawTerminal for a file
+ *              descriptor. The terminal is not changed until
+ *              enable() is called.
+** Params:   int fd: file descriptor of the terminal.
+ *              default = 0 (standard input).
+** Returns:  None
+*********************************************************************/
+RawTerminal::RawTerminal(int fd) : fd(fd), enabled(false), closed(false),
+        pending_start(0), pending_end(0)
+{
+    std::memset(&saved, 0, sizeof(saved));
+}
+
+
+/********************************************************************
+** Function: Destructor: Puts the terminal back into normal line
+ *              input if it is still in raw mode.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+RawTerminal::~RawTerminal()
+{
+    disable();
+}
+
+
+/********************************************************************
+** Function: isTerminal: Checks if the file descriptor is a
+ *              terminal that can be put in raw mode.
+** Params:   None
+** Returns:  bool: true if it is a terminal.
+*********************************************************************/
+bool RawTerminal::isTerminal() const
+{
+    return isatty(fd);
+}
+
+
+/********************************************************************
+** Function: enable: Switches the terminal to raw input: keys are
+ *              available as soon as they are pressed and are not
+ *              echoed. Output is left unchanged.
+** Params:   None
+** Returns:  bool: true if the terminal is in raw mode.
+*********************************************************************/
+bool RawTerminal::enable()
+{
+    if (enabled)
+    {
+        return true;
+    }
+
+    if (tcgetattr(fd, &saved) == -1)
+    {
+        return false;
+    }
+
+    //no line editing, no echo, and ctrl-c arrives as a key
+    struct termios raw = saved;
+    raw.c_lflag &= ~(ICANON | ECHO | ISIG | IEXTEN);
+    raw.c_iflag &= ~(IXON | ICRNL);
+    raw.c_cc[VMIN] = 0;
+    raw.c_cc[VTIME] = 0;
+
+    //TCSANOW keeps keys that were typed ahead
+    if (tcsetattr(fd, TCSANOW, &raw) == -1)
+    {
+        return false;
+    }
+
+    enabled = true;
+    return true;
+}
+
+
+/********************************************************************
+** Function: disable: Switches the terminal back to the line input
+ *              it had before enable() was called.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void RawTerminal::disable()
+{
+    if (enabled)
+    {
+        tcsetattr(fd, TCSANOW, &saved);
+        enabled = false;
+    }
+}
+
+
+/********************************************************************
+** Function: fill: Waits for input with poll and adds whatever is
+ *              available to the buffer.
+** Params:   int timeout: how long to wait in milliseconds, -1 to
+ *              wait until a key is pressed.
+** Returns:  bool: true if anything was added to the buffer.
+*********************************************************************/
+bool RawTerminal::fill(int timeout)
+{
+    //move unread keys to the front to make room
+    if (pending_start > 0)
+    {
+        std::memmove(pending, pending + pending_start, pending_end - pending_start);
+        pending_end -= pending_start;
+        pending_start = 0;
+    }
+
+    if (closed || pending_end == BUFFER_SIZE)
+    {
+        return false;
+    }
+
+    struct pollfd watch;
+    watch.fd = fd;
+    watch.events = POLLIN;
+    watch.revents = 0;
+
+    int ready = poll(&watch, 1, timeout);
+    if (ready == -1 && errno == EINTR)
+    {
+        return false;
+    }
+    if (ready <= 0)
+    {
+        //timed out, or the descriptor can't be polled
+        closed = (ready == -1);
+        return false;
+    }
+
+    ssize_t count = read(fd, pending + pending_end, BUFFER_SIZE - pending_end);
+    if (count <= 0)
+    {
+        //a ready descriptor with nothing to read has been closed
+        closed = (count == 0 || errno != EAGAIN);
+        return false;
+    }
+
+    pending_end += static_cast<int>(count);
+    return true;
+}
+
+
+/********************************************************************
+** Function: readKey: Returns the next key press, waiting for one
+ *              if none are buffered.
+** Params:   int timeout: how long to wait in milliseconds, -1 to
+ *              wait until a key is pressed.
+ *              default = -1.
+** Returns:  int: the character pressed, a Key for arrow keys,
+ *              NO_KEY if the wait timed out, or END_OF_INPUT if
+ *              the input was closed.
+*********************************************************************/
+int RawTerminal::readKey(int timeout)
+{
+    //wait for a key if none are buffered
+    while (pending_start == pending_end)
+    {
+        if (!fill(timeout))
+        {
+            if (closed)
+            {
+                return END_OF_INPUT;
+            }
+            if (timeout != -1)
+            {
+                return NO_KEY;
+            }
+        }
+    }
+
+    char key = pending[pending_start];
+
+    if (key == ESCAPE)
+    {
+        //arrow keys send ESC [ A through ESC [ D, give the rest of
+        // the sequence a moment to arrive
+        if (pending_end - pending_start < 3)
+        {
+            fill(ESCAPE_WAIT);
+        }
+
+        if (pending_end - pending_start >= 3
+            && (pending[pending_start + 1] == '[' || pending[pending_start + 1] == 'O'))
+        {
+            char code = pending[pending_start + 2];
+            if (code >= 'A' && code <= 'D')
+            {
+                pending_start += 3;
+
+                //A = up, B = down, C = right, D = left
+                const int ARROWS[] = {KEY_UP, KEY_DOWN, KEY_RIGHT, KEY_LEFT};
+                return ARROWS[code - 'A'];
+            }
+        }
+    }
+
+    pending_start++;
+    return static_cast<unsigned char>(key);
+}
@@ -0,0 +1,124 @@
+/*********************************************************************
+** Program name: RawTerminal.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 18, 2019 at 3:20 PM
+** Description: Class specification file for RawTerminal.
+ *              RawTerminal switches the terminal into raw input mode
+ *              so single key presses can be read without waiting for
+ *              enter, and switches it back to normal line input when
+ *              a prompt needs a whole line. Keys are read with poll
+ *              into a small buffer, so keys typed while the game is
+ *              busy drawing are kept until they are read. Arrow key
+ *              escape sequences are decoded into single keys.
+*********************************************************************/
+
+
+#ifndef RAW_TERMINAL_HPP
+#define RAW_TERMINAL_HPP
+
+#include <termios.h>
+
+class RawTerminal
+{
+public:
+    //keys that are not a single character
+    enum Key
+    {
+        END_OF_INPUT = -2,
+        NO_KEY = -1,
+        KEY_UP = 256,
+        KEY_RIGHT,
+        KEY_DOWN,
+        KEY_LEFT
+    };
+
+    //how long to wait for the rest of an escape sequence, in ms
+    static const int ESCAPE_WAIT;
+
+private:
+    //size of the buffer of keys that have not been read yet
+    enum {BUFFER_SIZE = 64};
+
+    int fd;
+    bool enabled;
+    bool closed;
+    struct termios saved;
+    char pending[BUFFER_SIZE];
+    int pending_start;
+    int pending_end;
+
+
+    /********************************************************************
+    ** Function: fill: Waits for input with poll and adds whatever is
+     *              available to the buffer.
+    ** Params:   int timeout: how long to wait in milliseconds, -1 to
+     *              wait until a key is pressed.
+    ** Returns:  bool: true if anything was added to the buffer.
+    *********************************************************************/
+    bool fill(int timeout);
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Creates a RawTerminal for a file
+     *              descriptor. The terminal is not changed until
+     *              enable() is called.
+    ** Params:   int fd: file descriptor of the terminal.
+     *              default = 0 (standard input).
+    ** Returns:  None
+    *********************************************************************/
+    RawTerminal(int fd = 0);
+
+
+    /********************************************************************
+    ** Function: Destructor: Puts the terminal back into normal line
+     *              input if it is still in raw mode.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    ~RawTerminal();
+
+
+    /********************************************************************
+    ** Function: isTerminal: Checks if the file descriptor is a
+     *              terminal that can be put in raw mode.
+    ** Params:   None
+    ** Returns:  bool: true if it is a terminal.
+    *********************************************************************/
+    bool isTerminal() const;
+
+
+    /********************************************************************
+    ** Function: enable: Switches the terminal to raw input: keys are
+     *              available as soon as they are pressed and are not
+     *              echoed. Output is left unchanged.
+    ** Params:   None
+    ** Returns:  bool: true if the terminal is in raw mode.
+    *********************************************************************/
+    bool enable();
+
+
+    /********************************************************************
+    ** Function: disable: Switches the terminal back to the line input
+     *              it had before enable() was called.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void disable();
+
+
+    /********************************************************************
+    ** Function: readKey: Returns the next key press, waiting for one
+     *              if none are buffered.
+    ** Params:   int timeout: how long to wait in milliseconds, -1 to
+     *              wait until a key is pressed.
+     *              default = -1.
+    ** Returns:  int: the character pressed, a Key for arrow keys,
+     *              NO_KEY if the wait timed out, or END_OF_INPUT if
+     *              the input was closed.
+    *********************************************************************/
+    int readKey(int timeout = -1);
+
+};
+
+#endif
@@ -18,10 +18,16 @@
 
 #include "Rocketship.hpp"
 
-using std::cout;
 using std::endl;
 using std::string;
 
+//initialize static prompts
+const int Rocketship::CHOICES_SIZE = 2;
+const string Rocketship::CHOICES[] = {"Check out the rocket ship",
+                                      "Fix the rocket ship"};
+const string Rocketship::ROCKET_PROMPT =
+        "This is your rocket ship. What do you want to do?";
+
 /********************************************************************
 ** Function: Constructor/default: Sets coordinates, type, description
  *              and icon.
@@ -62,16 +68,14 @@ bool Rocketship::interact(Human *traveler)
     {
         //initialize selection enum
         enum Actions {VIEW_SHIP = 1, FIX_SHIP};
-        //initialize prompts
-        const int CHOICES_SIZE = 2;
-        const string ROCKET_PROMPT =
-                "This is your rocket ship. What do you want to do?";
-        const string CHOICES[] = {"Check out the rocket ship",
-                                  "Fix the rocket ship"};
 
-        //get user selection
-        Actions selection = static_cast<Actions>
-                (menu.chooseOne(CHOICES, CHOICES_SIZE, ROCKET_PROMPT));
+        //get user selection, scripted games always try to fix the ship
+        Actions selection = FIX_SHIP;
+        if (!Menu::isAutoConfirm())
+        {
+            selection = static_cast<Actions>
+                    (menu.chooseOne(CHOICES, CHOICES_SIZE, ROCKET_PROMPT));
+        }
 
         if (selection == VIEW_SHIP)
         {
@@ -102,48 +106,47 @@ bool Rocketship::interact(Human *traveler)
 *********************************************************************/
 bool Rocketship::fixShip(const Inventory *resources)
 {
-    const int REQUIRED = 5;
     int plutonium_count = resources->count(PLUTONIUMORE);
     int ship_part_count = resources->count(SHIPPART);
     bool end_game = false;
 
     //print border
     menu.printBorder();
-    cout << endl;
+    IOBackend::out() << endl;
 
     //check for plutonium ore
-    if (plutonium_count < REQUIRED)
+    if (plutonium_count < REQUIRED_MATERIAL)
     {
-        cout << "You still need "
-             << (REQUIRED - plutonium_count)
+        IOBackend::out() << "You still need "
+             << (REQUIRED_MATERIAL - plutonium_count)
              << " more piece(s) of plutonium ore." << endl;
     }
 
     //check for ship parts
-    if (ship_part_count < REQUIRED)
+    if (ship_part_count < REQUIRED_MATERIAL)
     {
-        cout << "You still need "
-             << (REQUIRED - ship_part_count)
+        IOBackend::out() << "You still need "
+             << (REQUIRED_MATERIAL - ship_part_count)
              << " more ship part(s)." << endl;
     }
 
     //has everything, blast off!
-    if (plutonium_count == REQUIRED && ship_part_count == REQUIRED)
+    if (resources->objectiveComplete())
     {
-        cout << "Great! You have all the necessary material." << endl << endl;
-        cout << "Fixing the ship ... " << endl;
-        cout << "..." << endl << endl;
-        cout << "Okay, ready to go!" << endl;
-        cout << "Ignition stared..." << endl;
-        cout << "Blast off commencing in ..." << endl << endl;
-        cout << "...3" << endl;
-        cout << "...2" << endl;
-        cout << "...1" << endl;
-        cout << "..." << endl << endl;
-        cout << "BLASTOFF!" << endl << endl;
+        IOBackend::out() << "Great! You have all the necessary material." << endl << endl;
+        IOBackend::out() << "Fixing the ship ... " << endl;
+        IOBackend::out() << "..." << endl << endl;
+        IOBackend::out() << "Okay, ready to go!" << endl;
+        IOBackend::out() << "Ignition stared..." << endl;
+        IOBackend::out() << "Blast off commencing in ..." << endl << endl;
+        IOBackend::out() << "...3" << endl;
+        IOBackend::out() << "...2" << endl;
+        IOBackend::out() << "...1" << endl;
+        IOBackend::out() << "..." << endl << endl;
+        IOBackend::out() << "BLASTOFF!" << endl << endl;
 
         //print ascii art
-        cout << BLAST_OFF_ART << endl;
+        IOBackend::out() << BLAST_OFF_ART << endl;
 
         //end the game
         end_game = true;
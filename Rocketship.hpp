@@ -26,6 +26,12 @@
 
 class Rocketship : public Space
 {
+private:
+    //prompts for the rocket ship menu
+    static const int CHOICES_SIZE;
+    static const std::string CHOICES[];
+    static const std::string ROCKET_PROMPT;
+
 public:
 
     /********************************************************************
@@ -182,9 +182,9 @@ SpaceType Space::getType() const
 /********************************************************************
 ** Function: getDesc: Returns description of this space.
 ** Params:   None
-** Returns:  string: description of this space.
+** Returns:  const string &: description of this space.
 *********************************************************************/
-string Space::getDesc() const
+const string &Space::getDesc() const
 {
     return description;
 }
@@ -191,9 +191,9 @@ public:
     /********************************************************************
     ** Function: getDesc: Returns description of this space.
     ** Params:   None
-    ** Returns:  string: description of this space.
+    ** Returns:  const string &: description of this space.
     *********************************************************************/
-    std::string getDesc() const;
+    const std::string &getDesc() const;
 
 
     /********************************************************************
@@ -0,0 +1,51 @@
+/*********************************************************************
+** Program name: SpaceFactory.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 23, 2019 at 10:05 AM
+** Description: Class implementation file for SpaceFactory.
+ *              SpaceFactory has a static function that creates the
+ *              derived Space for a space type, with the description
+ *              and icon from the space config table. It is used to
+ *              set up the level and to change tiles while playing.
+*********************************************************************/
+
+
+#include "SpaceFactory.hpp"
+#include "Rocketship.hpp"
+#include "Crater.hpp"
+#include "SpaceRock.hpp"
+#include "Wormhole.hpp"
+#include "Ground.hpp"
+#include "Chasm.hpp"
+
+/********************************************************************
+** Function: create: Creates a space of the given type. The caller
+ *              owns the new space.
+** Params:   int x: x-coordinate of the space.
+ *           int y: y-coordinate of the space.
+ *           SpaceType type: type of space to create.
+** Returns:  Space *: the new space, or nullptr for DEFAULTSPACE.
+*********************************************************************/
+Space *SpaceFactory::create(int x, int y, SpaceType type)
+{
+    const std::string &description = SPACE_CONFIG_LT[type].description_default;
+    char icon = SPACE_CONFIG_LT[type].icon_default;
+
+    switch (type)
+    {
+        case ROCKETSHIP :
+            return new Rocketship(x, y, type, description, icon);
+        case CRATER :
+            return new Crater(x, y, type, description, icon);
+        case SPACEROCK :
+            return new SpaceRock(x, y, type, description, icon);
+        case WORMHOLE :
+            return new Wormhole(x, y, type, description, icon);
+        case GROUND :
+            return new Ground(x, y, type, description, icon);
+        case CHASM :
+            return new Chasm(x, y, type, description, icon);
+        default :
+            return nullptr;
+    }
+}
@@ -0,0 +1,35 @@
+/*********************************************************************
+** Program name: SpaceFactory.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 23, 2019 at 10:05 AM
+** Description: Class specification file for SpaceFactory.
+ *              SpaceFactory has a static function that creates the
+ *              derived Space for a space type, with the description
+ *              and icon from the space config table. It is used to
+ *              set up the level and to change tiles while playing.
+*********************************************************************/
+
+
+#ifndef SPACE_FACTORY_HPP
+#define SPACE_FACTORY_HPP
+
+#include "GameDefaults.hpp"
+#include "Space.hpp"
+
+class SpaceFactory
+{
+public:
+
+    /********************************************************************
+    ** Function: create: Creates a space of the given type. The caller
+     *              owns the new space.
+    ** Params:   int x: x-coordinate of the space.
+     *           int y: y-coordinate of the space.
+     *           SpaceType type: type of space to create.
+    ** Returns:  Space *: the new space, or nullptr for DEFAULTSPACE.
+    *********************************************************************/
+    static Space *create(int x, int y, SpaceType type);
+
+};
+
+#endif
@@ -14,10 +14,12 @@
 
 #include "SpaceRock.hpp"
 
-using std::cout;
 using std::endl;
 using std::string;
 
+//initialize static prompt
+const string SpaceRock::LIFT_PROMPT = "Do you want to check under the space rock?";
+
 /********************************************************************
 ** Function: Constructor/default: Sets coordinates, type, description
  *              and icon. Sets treasure, has alien, and alien name to
@@ -59,17 +61,14 @@ bool SpaceRock::interact(Human *traveler)
         menu.formatPrompt(getDesc());
 
         //ask user if they want to check under the rock
-        const string SPACE_ROCK_PROMPT =
-                "Do you want to check under the space rock?";
-
-        if (menu.confirm(SPACE_ROCK_PROMPT) == Menu::YES)
+        if (menu.confirm(LIFT_PROMPT) == Menu::YES)
         {
             //print border
             menu.printBorder();
-            cout << endl;
+            IOBackend::out() << endl;
 
             //print that you lifted up the rock
-            cout << "You lifted up the space rock..." << endl;
+            IOBackend::out() << "You lifted up the space rock..." << endl;
 
             //call parent AsteroidObject interact
             // to check for aliens or items
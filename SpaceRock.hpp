@@ -22,6 +22,10 @@
 
 class SpaceRock : public AsteroidObject
 {
+private:
+    //prompt asking if you want to search this space
+    static const std::string LIFT_PROMPT;
+
 public:
 
     /********************************************************************
@@ -0,0 +1,199 @@
+/*********************************************************************
+** Program name: TeleportTable.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 23, 2019 at 3:20 PM
+** Description: Class implementation file for TeleportTable.
+ *              TeleportTable picks where a worm hole sends the
+ *              traveler. It holds every cell of the board that can
+ *              be walked on, each with a weight set by its space
+ *              type, and picks one at random with the alias method:
+ *              every cell gets a column that it fills with its own
+ *              chance and tops up with the chance of one other cell,
+ *              so a pick is one random column and one coin flip, no
+ *              matter how large the board is. The table listens to
+ *              the board and is built again after every batch of
+ *              tile changes. It has its own random generator, since
+ *              rand() may not reach every cell of a large board.
+*********************************************************************/
+
+
+#include "TeleportTable.hpp"
+#include "Board.hpp"
+
+//chance of a column that always picks its own cell, out of 2^32
+static const std::uint64_t ALWAYS = 1ULL << 32;
+
+/********************************************************************
+** Function: Constructor/default: Creates an empty table where every
+ *              space type that can be walked on has a weight of 1.
+** Params:   uint64_t seed: seed for the picks, 0 is replaced
+ *              with 1.
+ *              default = time(0).
+** Returns:  None
+*********************************************************************/
+TeleportTable::TeleportTable(std::uint64_t seed)
+        : cols(0), random_state(seed ? seed : 1)
+{
+    //cells that can't be walked on, such as empty cells and chasms,
+    // are left out
+    for (int i=0; i<TYPE_COUNT; i++)
+    {
+        weights[i] = SPACE_CONFIG_LT[i].passable ? 1 : 0;
+    }
+}
+
+
+/********************************************************************
+** Function: nextRandom: Advances the xorshift generator.
+** Params:   None
+** Returns:  uint64_t: next random number.
+*********************************************************************/
+std::uint64_t TeleportTable::nextRandom()
+{
+    random_state ^= random_state >> 12;
+    random_state ^= random_state << 25;
+    random_state ^= random_state >> 27;
+    return random_state * 2685821657736338717ULL;
+}
+
+
+/********************************************************************
+** Function: setWeight: Sets how likely cells of a space type are to
+ *              be picked, compared to the others. Takes effect the
+ *              next time the table is built.
+** Params:   SpaceType type: space type.
+ *           int weight: weight of the type, 0 to never pick it.
+** Returns:  None
+*********************************************************************/
+void TeleportTable::setWeight(SpaceType type, int weight)
+{
+    weights[type] = (weight > 0) ? weight : 0;
+}
+
+
+/********************************************************************
+** Function: build: Builds the table from the cells of a board.
+** Params:   const Board &board: board to pick cells from.
+** Returns:  None
+*********************************************************************/
+void TeleportTable::build(const Board &board)
+{
+    cols = board.getCols();
+    cells.clear();
+    shares.clear();
+
+    //collect the cells that can be picked and their weights
+    std::int64_t total = 0;
+    for (int y=0; y<board.getRows(); y++)
+    {
+        for (int x=0; x<cols; x++)
+        {
+            int weight = weights[board.getType(x, y)];
+            if (weight > 0)
+            {
+                cells.push_back(y * cols + x);
+                shares.push_back(weight);
+                total += weight;
+            }
+        }
+    }
+
+    //every column starts out picking only its own cell
+    const int COUNT = size();
+    thresholds.assign(COUNT, ALWAYS);
+    aliases.assign(cells.begin(), cells.end());
+
+    //a column holds total, the share of a cell is its weight times the
+    // number of columns, so integers keep the shares exact
+    small.clear();
+    large.clear();
+    for (int i=0; i<COUNT; i++)
+    {
+        shares[i] *= COUNT;
+        if (shares[i] < total)
+        {
+            small.push_back(i);
+        }
+        else
+        {
+            large.push_back(i);
+        }
+    }
+
+    //top up each column that is short with part of a large share
+    while (!small.empty() && !large.empty())
+    {
+        int short_column = small.back();
+        int donor = large.back();
+        small.pop_back();
+
+        thresholds[short_column] = static_cast<std::uint64_t>(
+                static_cast<double>(shares[short_column]) / total * ALWAYS);
+        aliases[short_column] = cells[donor];
+
+        //the donor gives what the short column was missing
+        shares[donor] -= total - shares[short_column];
+        if (shares[donor] < total)
+        {
+            large.pop_back();
+            small.push_back(donor);
+        }
+    }
+
+    //columns left over are full, and keep picking their own cell
+}
+
+
+/********************************************************************
+** Function: tilesChanged: Builds the table again after tiles of
+ *              the board changed.
+** Params:   const Board &board: the board that changed.
+ *           int left: x-coordinate of the first changed column.
+ *           int top: y-coordinate of the first changed row.
+ *           int right: x-coordinate of the last changed column.
+ *           int bottom: y-coordinate of the last changed row.
+** Returns:  None
+*********************************************************************/
+void TeleportTable::tilesChanged(const Board &board, int left, int top,
+                                 int right, int bottom)
+{
+    build(board);
+}
+
+
+/********************************************************************
+** Function: pick: Picks a random cell, each one as likely as the
+ *              weight of its space type.
+** Params:   int &x: set to the x-coordinate of the cell.
+ *           int &y: set to the y-coordinate of the cell.
+** Returns:  bool: false if there are no cells to pick from.
+*********************************************************************/
+bool TeleportTable::pick(int &x, int &y)
+{
+    if (cells.empty())
+    {
+        return false;
+    }
+
+    //the high half picks the column without a division, the low half
+    // is the coin
+    std::uint64_t random = nextRandom();
+    std::uint64_t column = ((random >> 32) * cells.size()) >> 32;
+    std::uint64_t coin = random & (ALWAYS - 1);
+
+    int cell = (coin < thresholds[column]) ? cells[column] : aliases[column];
+    x = cell % cols;
+    y = cell / cols;
+    return true;
+}
+
+
+/********************************************************************
+** Function: size: Returns how many cells can be picked.
+** Params:   None
+** Returns:  int: number of cells.
+*********************************************************************/
+int TeleportTable::size() const
+{
+    return static_cast<int>(cells.size());
+}
@@ -0,0 +1,127 @@
+/*********************************************************************
+** Program name: TeleportTable.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 23, 2019 at 3:20 PM
+** Description: Class specification file for TeleportTable.
+ *              TeleportTable picks where a worm hole sends the
+ *              traveler. It holds every cell of the board that can
+ *              be walked on, each with a weight set by its space
+ *              type, and picks one at random with the alias method:
+ *              every cell gets a column that it fills with its own
+ *              chance and tops up with the chance of one other cell,
+ *              so a pick is one random column and one coin flip, no
+ *              matter how large the board is. The table listens to
+ *              the board and is built again after every batch of
+ *              tile changes. It has its own random generator, since
+ *              rand() may not reach every cell of a large board.
+*********************************************************************/
+
+
+#ifndef TELEPORT_TABLE_HPP
+#define TELEPORT_TABLE_HPP
+
+#include <cstdint>
+#include <ctime>
+#include <vector>
+#include "GameDefaults.hpp"
+#include "BoardListener.hpp"
+
+class TeleportTable : public BoardListener
+{
+public:
+    //number of space types, including empty cells
+    enum {TYPE_COUNT = GameDefaults::DEFAULTSPACE + 1};
+
+private:
+    int cols;
+    std::uint64_t random_state;
+
+    //weight of each space type, 0 leaves those cells out
+    int weights[TYPE_COUNT];
+
+    //for each column: the cell it belongs to, the chance out of 2^32
+    // of picking that cell, and the cell to pick otherwise. Cells
+    // are stored as y * cols + x
+    std::vector<int> cells;
+    std::vector<std::uint64_t> thresholds;
+    std::vector<int> aliases;
+
+    //work space for building, kept so building again doesn't allocate
+    std::vector<std::int64_t> shares;
+    std::vector<int> small;
+    std::vector<int> large;
+
+
+    /********************************************************************
+    ** Function: nextRandom: Advances the xorshift generator.
+    ** Params:   None
+    ** Returns:  uint64_t: next random number.
+    *********************************************************************/
+    std::uint64_t nextRandom();
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Creates an empty table where every
+     *              space type that can be walked on has a weight of 1.
+    ** Params:   uint64_t seed: seed for the picks, 0 is replaced
+     *              with 1.
+     *              default = time(0).
+    ** Returns:  None
+    *********************************************************************/
+    TeleportTable(std::uint64_t seed = time(0));
+
+
+    /********************************************************************
+    ** Function: setWeight: Sets how likely cells of a space type are to
+     *              be picked, compared to the others. Takes effect the
+     *              next time the table is built.
+    ** Params:   SpaceType type: space type.
+     *           int weight: weight of the type, 0 to never pick it.
+    ** Returns:  None
+    *********************************************************************/
+    void setWeight(SpaceType type, int weight);
+
+
+    /********************************************************************
+    ** Function: build: Builds the table from the cells of a board.
+    ** Params:   const Board &board: board to pick cells from.
+    ** Returns:  None
+    *********************************************************************/
+    void build(const Board &board);
+
+
+    /********************************************************************
+    ** Function: tilesChanged: Builds the table again after tiles of
+     *              the board changed.
+    ** Params:   const Board &board: the board that changed.
+     *           int left: x-coordinate of the first changed column.
+     *           int top: y-coordinate of the first changed row.
+     *           int right: x-coordinate of the last changed column.
+     *           int bottom: y-coordinate of the last changed row.
+    ** Returns:  None
+    *********************************************************************/
+    virtual void tilesChanged(const Board &board, int left, int top,
+                              int right, int bottom) override;
+
+
+    /********************************************************************
+    ** Function: pick: Picks a random cell, each one as likely as the
+     *              weight of its space type.
+    ** Params:   int &x: set to the x-coordinate of the cell.
+     *           int &y: set to the y-coordinate of the cell.
+    ** Returns:  bool: false if there are no cells to pick from.
+    *********************************************************************/
+    bool pick(int &x, int &y);
+
+
+    /********************************************************************
+    ** Function: size: Returns how many cells can be picked.
+    ** Params:   None
+    ** Returns:  int: number of cells.
+    *********************************************************************/
+    int size() const;
+
+};
+
+#endif
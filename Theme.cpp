@@ -0,0 +1,156 @@
+/*********************************************************************
+** Program name: Theme.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 15, 2019 at 2:50 PM
+** Description: Class implementation file for Theme. A Theme colors
+ *              the icons on the board with ANSI escape sequences.
+ *              When a theme is created, the complete output for a
+ *              cell (left border, color, icon, color reset) is built
+ *              once for every icon and stored in a lookup table, so
+ *              printing the board only copies bytes out of the table
+ *              and never formats anything per cell. The plain theme
+ *              has no colors and prints the board exactly as before.
+*********************************************************************/
+
+
+#include <cstring>
+#include "Theme.hpp"
+#include "GameDefaults.hpp"
+#include "Human.hpp"
+#include "FogOfWar.hpp"
+
+using std::string;
+
+//color definitions of the built-in themes, the plain theme comes first
+static const Theme::Colors BUILT_IN_COLORS[] =
+        {{"plain", nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr},
+         {"classic", "1;31", "37", "33", "1;35", "2;37", "1;30", "1;36", "2;34"},
+         {"contrast", "1;97;41", "1;97;100", "1;30;43", "1;97;45", "37", "97;40", "1;30;106", "90"}};
+
+static const int BUILT_IN_SIZE = 3;
+
+/********************************************************************
+** Function: Constructor: Builds the lookup table for every icon.
+** Params:   const Colors &colors: name and colors of the theme.
+** Returns:  None
+*********************************************************************/
+Theme::Theme(const Colors &colors) : name(colors.name), max_cell_length(0)
+{
+    //every icon starts out without a color
+    for (int i=0; i<ICON_COUNT; i++)
+    {
+        setCell(static_cast<char>(i), nullptr);
+    }
+
+    //color the icons of the spaces, the traveler and the fog
+    setCell(SPACE_CONFIG_LT[ROCKETSHIP].icon_default, colors.rocketship);
+    setCell(SPACE_CONFIG_LT[CRATER].icon_default, colors.crater);
+    setCell(SPACE_CONFIG_LT[SPACEROCK].icon_default, colors.space_rock);
+    setCell(SPACE_CONFIG_LT[WORMHOLE].icon_default, colors.wormhole);
+    setCell(SPACE_CONFIG_LT[GROUND].icon_default, colors.ground);
+    setCell(SPACE_CONFIG_LT[CHASM].icon_default, colors.chasm);
+    setCell(Human::DEFAULT_ICON, colors.traveler);
+    setCell(FogOfWar::UNKNOWN_ICON, colors.unknown);
+}
+
+
+/********************************************************************
+** Function: setCell: Builds the output for one icon.
+** Params:   char icon: icon to build the output for.
+ *           const char *color: SGR parameters for the icon, or
+ *              nullptr for no color.
+** Returns:  None
+*********************************************************************/
+void Theme::setCell(char icon, const char *color)
+{
+    string cell = "|";
+
+    if (color)
+    {
+        cell += "\x1b[";
+        cell += color;
+        cell += 'm';
+        cell += icon;
+        cell += "\x1b[0m";
+    }
+    else
+    {
+        cell += icon;
+    }
+
+    //colors are only ever the short built-in ones, but never overrun
+    if (cell.length() > MAX_CELL_LENGTH)
+    {
+        cell = string("|") + icon;
+    }
+
+    unsigned char index = static_cast<unsigned char>(icon);
+    std::memcpy(cells[index], cell.data(), cell.length());
+    cell_lengths[index] = static_cast<unsigned char>(cell.length());
+
+    if (static_cast<int>(cell.length()) > max_cell_length)
+    {
+        max_cell_length = static_cast<int>(cell.length());
+    }
+}
+
+
+/********************************************************************
+** Function: find: Looks up one of the built-in themes by name. The
+ *              built-in themes are created the first time they are
+ *              looked up.
+** Params:   const string &name: "plain", "classic" or "contrast".
+** Returns:  const Theme *: the theme, or nullptr if there is no
+ *              theme with that name.
+*********************************************************************/
+const Theme *Theme::find(const string &name)
+{
+    static const Theme BUILT_IN[] = {Theme(BUILT_IN_COLORS[0]),
+                                     Theme(BUILT_IN_COLORS[1]),
+                                     Theme(BUILT_IN_COLORS[2])};
+
+    for (int i=0; i<BUILT_IN_SIZE; i++)
+    {
+        if (BUILT_IN[i].getName() == name)
+        {
+            return &BUILT_IN[i];
+        }
+    }
+
+    return nullptr;
+}
+
+
+/********************************************************************
+** Function: plain: Returns the built-in theme without colors.
+** Params:   None
+** Returns:  const Theme &: the plain theme.
+*********************************************************************/
+const Theme &Theme::plain()
+{
+    static const Theme *PLAIN = find(BUILT_IN_COLORS[0].name);
+    return *PLAIN;
+}
+
+
+/********************************************************************
+** Function: getName: Returns the name of the theme.
+** Params:   None
+** Returns:  const string &: name of the theme.
+*********************************************************************/
+const string &Theme::getName() const
+{
+    return name;
+}
+
+
+/********************************************************************
+** Function: getMaxCellLength: Returns the longest output of any
+ *              icon, used to size row buffers.
+** Params:   None
+** Returns:  int: longest cell output in bytes.
+*********************************************************************/
+int Theme::getMaxCellLength() const
+{
+    return max_cell_length;
+}
@@ -0,0 +1,130 @@
+/*********************************************************************
+** Program name: Theme.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 15, 2019 at 2:50 PM
+** Description: Class specification file for Theme. A Theme colors
+ *              the icons on the board with ANSI escape sequences.
+ *              When a theme is created, the complete output for a
+ *              cell (left border, color, icon, color reset) is built
+ *              once for every icon and stored in a lookup table, so
+ *              printing the board only copies bytes out of the table
+ *              and never formats anything per cell. The plain theme
+ *              has no colors and prints the board exactly as before.
+*********************************************************************/
+
+
+#ifndef THEME_HPP
+#define THEME_HPP
+
+#include <string>
+
+class Theme
+{
+public:
+    //longest output for a single cell, in bytes
+    enum { MAX_CELL_LENGTH = 24 };
+
+    //colors to use for each icon, as SGR parameters such as "1;31"
+    struct Colors
+    {
+        const char *name;
+        const char *rocketship;
+        const char *crater;
+        const char *space_rock;
+        const char *wormhole;
+        const char *ground;
+        const char *chasm;
+        const char *traveler;
+        const char *unknown;
+    };
+
+private:
+    //number of possible icon characters
+    enum { ICON_COUNT = 256 };
+
+    std::string name;
+    int max_cell_length;
+    unsigned char cell_lengths[ICON_COUNT];
+    char cells[ICON_COUNT][MAX_CELL_LENGTH];
+
+    /********************************************************************
+    ** Function: setCell: Builds the output for one icon.
+    ** Params:   char icon: icon to build the output for.
+     *           const char *color: SGR parameters for the icon, or
+     *              nullptr for no color.
+    ** Returns:  None
+    *********************************************************************/
+    void setCell(char icon, const char *color);
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor: Builds the lookup table for every icon.
+    ** Params:   const Colors &colors: name and colors of the theme.
+    ** Returns:  None
+    *********************************************************************/
+    Theme(const Colors &colors);
+
+
+    /********************************************************************
+    ** Function: find: Looks up one of the built-in themes by name. The
+     *              built-in themes are created the first time they are
+     *              looked up.
+    ** Params:   const string &name: "plain", "classic" or "contrast".
+    ** Returns:  const Theme *: the theme, or nullptr if there is no
+     *              theme with that name.
+    *********************************************************************/
+    static const Theme *find(const std::string &name);
+
+
+    /********************************************************************
+    ** Function: plain: Returns the built-in theme without colors.
+    ** Params:   None
+    ** Returns:  const Theme &: the plain theme.
+    *********************************************************************/
+    static const Theme &plain();
+
+
+    /********************************************************************
+    ** Function: getName: Returns the name of the theme.
+    ** Params:   None
+    ** Returns:  const string &: name of the theme.
+    *********************************************************************/
+    const std::string &getName() const;
+
+
+    /********************************************************************
+    ** Function: getCell: Returns the precomputed output for an icon,
+     *              starting with the cell's left border.
+    ** Params:   char icon: icon of the cell.
+    ** Returns:  const char *: bytes to print, not null-terminated.
+    *********************************************************************/
+    const char *getCell(char icon) const
+    {
+        return cells[static_cast<unsigned char>(icon)];
+    }
+
+
+    /********************************************************************
+    ** Function: getCellLength: Returns the length of the precomputed
+     *              output for an icon.
+    ** Params:   char icon: icon of the cell.
+    ** Returns:  int: number of bytes to print.
+    *********************************************************************/
+    int getCellLength(char icon) const
+    {
+        return cell_lengths[static_cast<unsigned char>(icon)];
+    }
+
+
+    /********************************************************************
+    ** Function: getMaxCellLength: Returns the longest output of any
+     *              icon, used to size row buffers.
+    ** Params:   None
+    ** Returns:  int: longest cell output in bytes.
+    *********************************************************************/
+    int getMaxCellLength() const;
+
+};
+
+#endif
@@ -0,0 +1,133 @@
+/*********************************************************************
+** Program name: TileBatch.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 23, 2019 at 10:05 AM
+** Description: Class specification file for TileBatch. TileBatch
+ *              holds a list of changes to make to the tiles of a
+ *              board, such as turning the ground hit by a meteor
+ *              shower into craters or burying items, so the board
+ *              can make them all at once with Board::apply. Each
+ *              change covers a rectangle of cells, so changing a
+ *              large area is still one entry. Clearing the batch
+ *              keeps its room, so a batch that is reused doesn't
+ *              allocate. The ship and worm holes are placed by the
+ *              level and linked by the game, so a batch never makes
+ *              or replaces them.
+*********************************************************************/
+
+
+#ifndef TILE_BATCH_HPP
+#define TILE_BATCH_HPP
+
+#include <vector>
+#include "GameDefaults.hpp"
+
+class TileBatch
+{
+public:
+    //what a change does to each cell it covers
+    enum Kind
+    {
+        SET_TYPE,
+        BURY_ITEM
+    };
+
+    //from value of a change that applies to any space type
+    static const int ANY_TYPE;
+
+    //one change, covering the cells from (left, top) to (right, bottom)
+    struct Change
+    {
+        Kind kind;
+        int left;
+        int top;
+        int right;
+        int bottom;
+        int from;
+        int value;
+    };
+
+private:
+    std::vector<Change> changes;
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Creates an empty batch.
+    ** Params:   int capacity: changes to make room for up front.
+     *              default = 16.
+    ** Returns:  None
+    *********************************************************************/
+    TileBatch(int capacity = 16);
+
+
+    /********************************************************************
+    ** Function: setType: Adds a change that replaces a cell with a
+     *              new space of the given type. Types that aren't a
+     *              real space, such as DEFAULTSPACE, and the ship and
+     *              worm holes, which only the level places, are left
+     *              out.
+    ** Params:   int x: x-coordinate of the cell.
+     *           int y: y-coordinate of the cell.
+     *           SpaceType type: type of the new space.
+    ** Returns:  bool: true if the change was added.
+    *********************************************************************/
+    bool setType(int x, int y, SpaceType type);
+
+
+    /********************************************************************
+    ** Function: convert: Adds a change that replaces every cell of one
+     *              type in a rectangle with a new space of another
+     *              type. Cells of other types are left alone. Types
+     *              that aren't a real space, such as DEFAULTSPACE,
+     *              and the ship and worm holes can't be the new type.
+    ** Params:   int left: x-coordinate of the first column.
+     *           int top: y-coordinate of the first row.
+     *           int right: x-coordinate of the last column.
+     *           int bottom: y-coordinate of the last row.
+     *           SpaceType from: type of the cells to replace.
+     *           SpaceType to: type of the new spaces.
+    ** Returns:  bool: true if the change was added.
+    *********************************************************************/
+    bool convert(int left, int top, int right, int bottom,
+                 SpaceType from, SpaceType to);
+
+
+    /********************************************************************
+    ** Function: bury: Adds a change that hides an item in a cell, if
+     *              the cell is a crater or space rock with nothing
+     *              hidden in it yet.
+    ** Params:   int x: x-coordinate of the cell.
+     *           int y: y-coordinate of the cell.
+     *           ItemType type: type of the item.
+    ** Returns:  None
+    *********************************************************************/
+    void bury(int x, int y, ItemType type);
+
+
+    /********************************************************************
+    ** Function: clear: Removes every change, keeping the room.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void clear();
+
+
+    /********************************************************************
+    ** Function: size: Returns how many changes are in the batch.
+    ** Params:   None
+    ** Returns:  int: number of changes.
+    *********************************************************************/
+    int size() const;
+
+
+    /********************************************************************
+    ** Function: getChange: Returns a change in the batch.
+    ** Params:   int index: 0 up to size.
+    ** Returns:  const Change &: the change.
+    *********************************************************************/
+    const Change &getChange(int index) const;
+
+};
+
+#endif
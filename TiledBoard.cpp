@@ -0,0 +1,53 @@
+/*********************************************************************
+** Program name: TiledBoard.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 14, 2019 at 10:20 AM
+** Description: Class implementation file for TiledBoard. TiledBoard
+ *              builds a board of any size by repeating the level
+ *              design across it. Every cell of the same space type
+ *              points to one shared Space object, so even very large
+ *              boards only cost a pointer per cell. The shared spaces
+ *              have no links, aliens or items, so a tiled board is
+ *              only meant for rendering, exporting and benchmarking,
+ *              not for playing.
+*********************************************************************/
+
+
+#include "TiledBoard.hpp"
+
+/********************************************************************
+** Function: Constructor: Creates the board and fills every cell
+ *              with the shared space for the matching cell of the
+ *              level design.
+** Params:   int rows: number of rows of the board.
+ *           int cols: number of columns of the board.
+** Returns:  None
+*********************************************************************/
+TiledBoard::TiledBoard(int rows, int cols) : board(rows, cols)
+{
+    //the level design is a 10x10 map listed row by row
+    const int LEVEL_SIZE = 10;
+
+    Space *shared[] = {&rocketship, &crater, &space_rock, &wormhole, &ground,
+                       &chasm};
+
+    for (int y=0; y<rows; y++)
+    {
+        for (int x=0; x<cols; x++)
+        {
+            int cell = (y % LEVEL_SIZE) * LEVEL_SIZE + (x % LEVEL_SIZE);
+            board.setSpace(x, y, shared[SPACE_LOCATIONS_LT[cell].type]);
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: getBoard: Returns the tiled board.
+** Params:   None
+** Returns:  Board &: the tiled board.
+*********************************************************************/
+Board &TiledBoard::getBoard()
+{
+    return board;
+}
@@ -0,0 +1,62 @@
+/*********************************************************************
+** Program name: TiledBoard.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 14, 2019 at 10:20 AM
+** Description: Class specification file for TiledBoard. TiledBoard
+ *              builds a board of any size by repeating the level
+ *              design across it. Every cell of the same space type
+ *              points to one shared Space object, so even very large
+ *              boards only cost a pointer per cell. The shared spaces
+ *              have no links, aliens or items, so a tiled board is
+ *              only meant for rendering, exporting and benchmarking,
+ *              not for playing.
+*********************************************************************/
+
+
+#ifndef TILED_BOARD_HPP
+#define TILED_BOARD_HPP
+
+#include "Board.hpp"
+#include "Rocketship.hpp"
+#include "Crater.hpp"
+#include "SpaceRock.hpp"
+#include "Wormhole.hpp"
+#include "Ground.hpp"
+#include "Chasm.hpp"
+
+class TiledBoard
+{
+private:
+    //one shared space per space type
+    Rocketship rocketship;
+    Crater crater;
+    SpaceRock space_rock;
+    Wormhole wormhole;
+    Ground ground;
+    Chasm chasm;
+
+    Board board;
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor: Creates the board and fills every cell
+     *              with the shared space for the matching cell of the
+     *              level design.
+    ** Params:   int rows: number of rows of the board.
+     *           int cols: number of columns of the board.
+    ** Returns:  None
+    *********************************************************************/
+    TiledBoard(int rows, int cols);
+
+
+    /********************************************************************
+    ** Function: getBoard: Returns the tiled board.
+    ** Params:   None
+    ** Returns:  Board &: the tiled board.
+    *********************************************************************/
+    Board &getBoard();
+
+};
+
+#endif
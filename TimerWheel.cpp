@@ -0,0 +1,241 @@
+/*********************************************************************
+** Program name: TimerWheel.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 22, 2019 at 4:40 PM
+** Description: Class implementation file for TimerWheel. TimerWheel
+ *              holds game events that happen a number of steps from
+ *              now, such as an alien coming back to its hiding spot
+ *              or the traveler's suit leaking oxygen, and events that
+ *              repeat every few steps. Events are kept in a ring of
+ *              slots, one per step, and an event goes in the slot its
+ *              step lands on. Advancing a step only looks at one
+ *              slot, so scheduling and firing an event takes the same
+ *              time no matter how many events are waiting. Events
+ *              further away than the ring wait in their slot for the
+ *              ring to come around again. Events are kept in a pool
+ *              that reuses the space of fired events, so steps don't
+ *              allocate once the pool is big enough.
+*********************************************************************/
+
+
+#include "TimerWheel.hpp"
+
+//initialize no event id
+const int TimerWheel::NONE = -1;
+
+//index of a node that is in no list
+static const int UNLINKED = -2;
+
+/********************************************************************
+** Function: Constructor/default: Creates an empty wheel at step 0.
+** Params:   int capacity: events to make room for up front, so
+ *              scheduling that many doesn't allocate.
+ *              default = 64.
+** Returns:  None
+*********************************************************************/
+TimerWheel::TimerWheel(int capacity) : now(0), pending(0), free_list(NONE)
+{
+    for (int i=0; i<SLOTS; i++)
+    {
+        heads[i] = NONE;
+    }
+
+    nodes.reserve(capacity);
+    fired.reserve(capacity);
+}
+
+
+/********************************************************************
+** Function: link: Adds a node to the front of the slot for its
+ *              step.
+** Params:   int id: index of the node.
+** Returns:  None
+*********************************************************************/
+void TimerWheel::link(int id)
+{
+    int slot = static_cast<int>(nodes[id].when & (SLOTS - 1));
+
+    nodes[id].previous = NONE;
+    nodes[id].next = heads[slot];
+    if (heads[slot] != NONE)
+    {
+        nodes[heads[slot]].previous = id;
+    }
+    heads[slot] = id;
+}
+
+
+/********************************************************************
+** Function: unlink: Removes a node from the slot it is in.
+** Params:   int id: index of the node.
+** Returns:  None
+*********************************************************************/
+void TimerWheel::unlink(int id)
+{
+    Node &node = nodes[id];
+
+    if (node.previous != NONE)
+    {
+        nodes[node.previous].next = node.next;
+    }
+    else
+    {
+        heads[node.when & (SLOTS - 1)] = node.next;
+    }
+
+    if (node.next != NONE)
+    {
+        nodes[node.next].previous = node.previous;
+    }
+}
+
+
+/********************************************************************
+** Function: schedule: Adds an event that fires a number of steps
+ *              from now, and again every period steps after that
+ *              if period is more than 0.
+** Params:   int delay: steps until the event fires, at least 1.
+ *           const Event &event: the event.
+ *           int period: steps between repeats, 0 to fire once.
+ *              default = 0.
+** Returns:  int: id of the event, for cancel, or NONE if delay or
+ *              period is negative.
+*********************************************************************/
+int TimerWheel::schedule(int delay, const Event &event, int period)
+{
+    if (delay < 0 || period < 0)
+    {
+        return NONE;
+    }
+
+    //reuse a fired node if there is one
+    int id = free_list;
+    if (id != NONE)
+    {
+        free_list = nodes[id].next;
+    }
+    else
+    {
+        id = static_cast<int>(nodes.size());
+        nodes.push_back(Node());
+
+        //keep room to report every event firing on the same step
+        if (fired.capacity() < nodes.size())
+        {
+            fired.reserve(nodes.capacity());
+        }
+    }
+
+    //an event can't fire on the step that is already done
+    nodes[id].event = event;
+    nodes[id].when = now + (delay > 0 ? delay : 1);
+    nodes[id].period = period;
+    link(id);
+
+    pending++;
+    return id;
+}
+
+
+/********************************************************************
+** Function: cancel: Removes an event that hasn't fired yet, or
+ *              stops a repeating one. Ids are reused once an event
+ *              is done, so only cancel events that are waiting.
+** Params:   int id: id returned by schedule.
+** Returns:  bool: false if there is no such event waiting.
+*********************************************************************/
+bool TimerWheel::cancel(int id)
+{
+    if (id < 0 || id >= static_cast<int>(nodes.size()) || nodes[id].previous == UNLINKED)
+    {
+        return false;
+    }
+
+    unlink(id);
+    nodes[id].previous = UNLINKED;
+    nodes[id].next = free_list;
+    free_list = id;
+
+    pending--;
+    return true;
+}
+
+
+/********************************************************************
+** Function: advance: Moves one step forward and fires the events
+ *              due on it. Repeating events are scheduled again.
+** Params:   None
+** Returns:  int: number of events fired, see getFired.
+*********************************************************************/
+int TimerWheel::advance()
+{
+    now++;
+    fired.clear();
+
+    //only this step's slot can have events due
+    int id = heads[now & (SLOTS - 1)];
+    while (id != NONE)
+    {
+        //read the next one first, firing moves this node
+        int next = nodes[id].next;
+
+        //events a whole turn of the ring away stay for later
+        if (nodes[id].when == now)
+        {
+            fired.push_back(nodes[id].event);
+            unlink(id);
+
+            if (nodes[id].period > 0)
+            {
+                //goes to the front of its slot, so this walk won't see
+                // it again even if the period lands on the same slot
+                nodes[id].when += nodes[id].period;
+                link(id);
+            }
+            else
+            {
+                nodes[id].previous = UNLINKED;
+                nodes[id].next = free_list;
+                free_list = id;
+                pending--;
+            }
+        }
+
+        id = next;
+    }
+
+    return static_cast<int>(fired.size());
+}
+
+
+/********************************************************************
+** Function: getFired: Returns an event fired on the last step.
+** Params:   int index: 0 up to the count returned by advance.
+** Returns:  const Event &: the event.
+*********************************************************************/
+const TimerWheel::Event &TimerWheel::getFired(int index) const
+{
+    return fired[index];
+}
+
+
+/********************************************************************
+** Function: getStep: Returns how many steps have gone by.
+** Params:   None
+** Returns:  long: current step.
+*********************************************************************/
+long TimerWheel::getStep() const
+{
+    return now;
+}
+
+
+/********************************************************************
+** Function: size: Returns how many events are waiting.
+** Params:   None
+** Returns:  int: number of events.
+*********************************************************************/
+int TimerWheel::size() const
+{
+    return pending;
+}
@@ -0,0 +1,153 @@
+/*********************************************************************
+** Program name: TimerWheel.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 22, 2019 at 4:40 PM
+** Description: Class specification file for TimerWheel. TimerWheel
+ *              holds game events that happen a number of steps from
+ *              now, such as an alien coming back to its hiding spot
+ *              or the traveler's suit leaking oxygen, and events that
+ *              repeat every few steps. Events are kept in a ring of
+ *              slots, one per step, and an event goes in the slot its
+ *              step lands on. Advancing a step only looks at one
+ *              slot, so scheduling and firing an event takes the same
+ *              time no matter how many events are waiting. Events
+ *              further away than the ring wait in their slot for the
+ *              ring to come around again. Events are kept in a pool
+ *              that reuses the space of fired events, so steps don't
+ *              allocate once the pool is big enough.
+*********************************************************************/
+
+
+#ifndef TIMER_WHEEL_HPP
+#define TIMER_WHEEL_HPP
+
+#include <vector>
+
+class TimerWheel
+{
+public:
+    //an event, what it means is up to whoever schedules it
+    struct Event
+    {
+        int kind;
+        int x;
+        int y;
+        int value;
+    };
+
+    //number of slots, a power of two so a step maps to its slot
+    // with a mask
+    enum {SLOTS = 256};
+
+    //id of no event, returned when scheduling fails
+    static const int NONE;
+
+private:
+    //a waiting event, linked into the list of its slot, or into the
+    // free list once it has fired
+    struct Node
+    {
+        Event event;
+        long when;
+        int period;
+        int previous;
+        int next;
+    };
+
+    long now;
+    int pending;
+    int free_list;
+    int heads[SLOTS];
+    std::vector<Node> nodes;
+
+    //events fired on the last step
+    std::vector<Event> fired;
+
+
+    /********************************************************************
+    ** Function: link: Adds a node to the front of the slot for its
+     *              step.
+    ** Params:   int id: index of the node.
+    ** Returns:  None
+    *********************************************************************/
+    void link(int id);
+
+
+    /********************************************************************
+    ** Function: unlink: Removes a node from the slot it is in.
+    ** Params:   int id: index of the node.
+    ** Returns:  None
+    *********************************************************************/
+    void unlink(int id);
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Creates an empty wheel at step 0.
+    ** Params:   int capacity: events to make room for up front, so
+     *              scheduling that many doesn't allocate.
+     *              default = 64.
+    ** Returns:  None
+    *********************************************************************/
+    TimerWheel(int capacity = 64);
+
+
+    /********************************************************************
+    ** Function: schedule: Adds an event that fires a number of steps
+     *              from now, and again every period steps after that
+     *              if period is more than 0.
+    ** Params:   int delay: steps until the event fires, at least 1.
+     *           const Event &event: the event.
+     *           int period: steps between repeats, 0 to fire once.
+     *              default = 0.
+    ** Returns:  int: id of the event, for cancel, or NONE if delay or
+     *              period is negative.
+    *********************************************************************/
+    int schedule(int delay, const Event &event, int period = 0);
+
+
+    /********************************************************************
+    ** Function: cancel: Removes an event that hasn't fired yet, or
+     *              stops a repeating one. Ids are reused once an event
+     *              is done, so only cancel events that are waiting.
+    ** Params:   int id: id returned by schedule.
+    ** Returns:  bool: false if there is no such event waiting.
+    *********************************************************************/
+    bool cancel(int id);
+
+
+    /********************************************************************
+    ** Function: advance: Moves one step forward and fires the events
+     *              due on it. Repeating events are scheduled again.
+    ** Params:   None
+    ** Returns:  int: number of events fired, see getFired.
+    *********************************************************************/
+    int advance();
+
+
+    /********************************************************************
+    ** Function: getFired: Returns an event fired on the last step.
+    ** Params:   int index: 0 up to the count returned by advance.
+    ** Returns:  const Event &: the event.
+    *********************************************************************/
+    const Event &getFired(int index) const;
+
+
+    /********************************************************************
+    ** Function: getStep: Returns how many steps have gone by.
+    ** Params:   None
+    ** Returns:  long: current step.
+    *********************************************************************/
+    long getStep() const;
+
+
+    /********************************************************************
+    ** Function: size: Returns how many events are waiting.
+    ** Params:   None
+    ** Returns:  int: number of events.
+    *********************************************************************/
+    int size() const;
+
+};
+
+#endif
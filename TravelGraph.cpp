@@ -0,0 +1,218 @@
+/*********************************************************************
+** Program name: TravelGraph.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 24, 2019 at 9:40 AM
+** Description: Class implementation file for TravelGraph.
+ *              TravelGraph holds how much oxygen it takes to get
+ *              from every cell of the board to every other cell,
+ *              walking or going through linked worm holes, and which
+ *              cells can reach each other both ways. Stepping onto a
+ *              cell costs the oxygen of its space type, and a linked
+ *              worm hole sends you to the other end for free, since
+ *              checking a space uses no oxygen. Everything is worked
+ *              out when the graph is built, one CostField search from
+ *              each cell, so bots and hints look up travel times in
+ *              constant time. The table has an entry for every pair
+ *              of cells, so the graph is meant for level-sized
+ *              boards and refuses boards with more than MAX_CELLS
+ *              cells. It listens to the board and is built again
+ *              after every batch of tile changes.
+*********************************************************************/
+
+
+#include "TravelGraph.hpp"
+#include "Board.hpp"
+
+//initialize distance constants
+const int TravelGraph::UNREACHABLE = -1;
+const unsigned short TravelGraph::NO_PATH = 0xFFFF;
+
+/********************************************************************
+** Function: Constructor/default: Creates an empty graph.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+TravelGraph::TravelGraph() : rows(0), cols(0), component_count(0), field(0, 0)
+{}
+
+
+/********************************************************************
+** Function: cell: Returns the index of a cell, or -1 if it is off
+ *              the board.
+** Params:   int x: x-coordinate.
+ *           int y: y-coordinate.
+** Returns:  int: index of the cell.
+*********************************************************************/
+int TravelGraph::cell(int x, int y) const
+{
+    if (x < 0 || x >= cols || y < 0 || y >= rows)
+    {
+        return -1;
+    }
+    return y * cols + x;
+}
+
+
+/********************************************************************
+** Function: setLinks: Sets the worm holes that lead to each other.
+ *              Takes effect the next time the graph is built.
+** Params:   const WormholeLink *list: links, one way each.
+ *           int count: number of links.
+** Returns:  None
+*********************************************************************/
+void TravelGraph::setLinks(const GameDefaults::WormholeLink *list, int count)
+{
+    link_list.assign(list, list + count);
+}
+
+
+/********************************************************************
+** Function: build: Works out the oxygen between every pair of cells
+ *              of a board and which cells can reach each other.
+ *              Empty cells and chasms can't be walked on.
+** Params:   const Board &board: board to build the graph for.
+** Returns:  bool: false if the board has more than MAX_CELLS
+ *              cells, the graph is left empty.
+*********************************************************************/
+bool TravelGraph::build(const Board &board)
+{
+    rows = board.getRows();
+    cols = board.getCols();
+    component_count = 0;
+
+    if (rows * cols > MAX_CELLS)
+    {
+        rows = 0;
+        cols = 0;
+        distances.clear();
+        components.clear();
+        return false;
+    }
+
+    const int COUNT = rows * cols;
+
+    field.resize(rows, cols);
+    field.setCosts(board);
+
+    //only worm holes lead anywhere, the field skips blocked targets
+    for (std::size_t i=0; i<link_list.size(); i++)
+    {
+        const GameDefaults::WormholeLink &link = link_list[i];
+
+        if (cell(link.from_x, link.from_y) >= 0 && cell(link.to_x, link.to_y) >= 0
+            && board.getType(link.from_x, link.from_y) == WORMHOLE)
+        {
+            field.setLink(link.from_x, link.from_y, link.to_x, link.to_y);
+        }
+    }
+
+    //one search from every cell fills the table
+    distances.assign(static_cast<std::size_t>(COUNT) * COUNT, NO_PATH);
+    for (int start=0; start<COUNT; start++)
+    {
+        if (field.search(start % cols, start / cols) == 0)
+        {
+            continue;
+        }
+
+        unsigned short *row = &distances[static_cast<std::size_t>(start) * COUNT];
+        for (int other=0; other<COUNT; other++)
+        {
+            int oxygen = field.distance(other % cols, other / cols);
+            if (oxygen != CostField::UNREACHABLE)
+            {
+                row[other] = static_cast<unsigned short>(oxygen);
+            }
+        }
+    }
+
+    //cells that reach each other both ways share a component
+    components.assign(COUNT, -1);
+    for (int first=0; first<COUNT; first++)
+    {
+        if (components[first] != -1 || board.isBlocked(first % cols, first / cols))
+        {
+            continue;
+        }
+
+        const unsigned short *from_first = &distances[static_cast<std::size_t>(first) * COUNT];
+        for (int other=first; other<COUNT; other++)
+        {
+            if (components[other] == -1 && from_first[other] != NO_PATH
+                && distances[static_cast<std::size_t>(other) * COUNT + first] != NO_PATH)
+            {
+                components[other] = component_count;
+            }
+        }
+        component_count++;
+    }
+
+    return true;
+}
+
+
+/********************************************************************
+** Function: tilesChanged: Builds the graph again after tiles of
+ *              the board changed.
+** Params:   const Board &board: the board that changed.
+ *           int left: x-coordinate of the first changed column.
+ *           int top: y-coordinate of the first changed row.
+ *           int right: x-coordinate of the last changed column.
+ *           int bottom: y-coordinate of the last changed row.
+** Returns:  None
+*********************************************************************/
+void TravelGraph::tilesChanged(const Board &board, int left, int top,
+                               int right, int bottom)
+{
+    build(board);
+}
+
+
+/********************************************************************
+** Function: distance: Returns the least oxygen it takes to get from
+ *              one cell to another.
+** Params:   int from_x: x-coordinate to start at.
+ *           int from_y: y-coordinate to start at.
+ *           int to_x: x-coordinate to get to.
+ *           int to_y: y-coordinate to get to.
+** Returns:  int: oxygen, or UNREACHABLE.
+*********************************************************************/
+int TravelGraph::distance(int from_x, int from_y, int to_x, int to_y) const
+{
+    int from = cell(from_x, from_y);
+    int to = cell(to_x, to_y);
+
+    if (from < 0 || to < 0)
+    {
+        return UNREACHABLE;
+    }
+
+    unsigned short steps = distances[static_cast<std::size_t>(from) * rows * cols + to];
+    return (steps == NO_PATH) ? UNREACHABLE : steps;
+}
+
+
+/********************************************************************
+** Function: component: Returns the component of a cell. Cells in
+ *              the same component can reach each other both ways.
+** Params:   int x: x-coordinate.
+ *           int y: y-coordinate.
+** Returns:  int: 0 up to componentCount, or -1 if the cell can't
+ *              be walked on.
+*********************************************************************/
+int TravelGraph::component(int x, int y) const
+{
+    int index = cell(x, y);
+    return (index < 0) ? -1 : components[index];
+}
+
+
+/********************************************************************
+** Function: componentCount: Returns how many components there are.
+** Params:   None
+** Returns:  int: number of components.
+*********************************************************************/
+int TravelGraph::componentCount() const
+{
+    return component_count;
+}
@@ -0,0 +1,149 @@
+/*********************************************************************
+** Program name: TravelGraph.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 24, 2019 at 9:40 AM
+** Description: Class specification file for TravelGraph. TravelGraph
+ *              holds how much oxygen it takes to get from every cell
+ *              of the board to every other cell, walking or going
+ *              through linked worm holes, and which cells can reach
+ *              each other both ways. Stepping onto a cell costs the
+ *              oxygen of its space type, and a linked worm hole
+ *              sends you to the other end for free, since checking a
+ *              space uses no oxygen. Everything is worked out when
+ *              the graph is built, one CostField search from each
+ *              cell, so bots and hints look up travel times in
+ *              constant time. The table has an entry for every pair
+ *              of cells, so the graph is meant for level-sized
+ *              boards and refuses boards with more than MAX_CELLS
+ *              cells. It listens to the board and is built again
+ *              after every batch of tile changes.
+*********************************************************************/
+
+
+#ifndef TRAVEL_GRAPH_HPP
+#define TRAVEL_GRAPH_HPP
+
+#include <vector>
+#include "GameDefaults.hpp"
+#include "BoardListener.hpp"
+#include "CostField.hpp"
+
+class TravelGraph : public BoardListener
+{
+public:
+    //oxygen reported between cells that can't reach each other
+    static const int UNREACHABLE;
+
+    //largest board the graph is built for, the table takes 2 bytes
+    // for every pair of cells, and the longest trip, MAX_COST oxygen
+    // for every cell, still fits in them
+    enum {MAX_CELLS = 4096};
+
+private:
+    //stored distance between cells that can't reach each other
+    static const unsigned short NO_PATH;
+
+    int rows;
+    int cols;
+    int component_count;
+
+    //worm holes that lead to each other
+    std::vector<GameDefaults::WormholeLink> link_list;
+
+    //oxygen from each cell to each cell, row by row by starting cell
+    std::vector<unsigned short> distances;
+
+    //component of each cell, -1 for cells that can't be walked on
+    std::vector<int> components;
+
+    //field searched from each cell in turn
+    CostField field;
+
+
+    /********************************************************************
+    ** Function: cell: Returns the index of a cell, or -1 if it is off
+     *              the board.
+    ** Params:   int x: x-coordinate.
+     *           int y: y-coordinate.
+    ** Returns:  int: index of the cell.
+    *********************************************************************/
+    int cell(int x, int y) const;
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Creates an empty graph.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    TravelGraph();
+
+
+    /********************************************************************
+    ** Function: setLinks: Sets the worm holes that lead to each other.
+     *              Takes effect the next time the graph is built.
+    ** Params:   const WormholeLink *list: links, one way each.
+     *           int count: number of links.
+    ** Returns:  None
+    *********************************************************************/
+    void setLinks(const GameDefaults::WormholeLink *list, int count);
+
+
+    /********************************************************************
+    ** Function: build: Works out the oxygen between every pair of cells
+     *              of a board and which cells can reach each other.
+     *              Empty cells and chasms can't be walked on.
+    ** Params:   const Board &board: board to build the graph for.
+    ** Returns:  bool: false if the board has more than MAX_CELLS
+     *              cells, the graph is left empty.
+    *********************************************************************/
+    bool build(const Board &board);
+
+
+    /********************************************************************
+    ** Function: tilesChanged: Builds the graph again after tiles of
+     *              the board changed.
+    ** Params:   const Board &board: the board that changed.
+     *           int left: x-coordinate of the first changed column.
+     *           int top: y-coordinate of the first changed row.
+     *           int right: x-coordinate of the last changed column.
+     *           int bottom: y-coordinate of the last changed row.
+    ** Returns:  None
+    *********************************************************************/
+    virtual void tilesChanged(const Board &board, int left, int top,
+                              int right, int bottom) override;
+
+
+    /********************************************************************
+    ** Function: distance: Returns the least oxygen it takes to get from
+     *              one cell to another.
+    ** Params:   int from_x: x-coordinate to start at.
+     *           int from_y: y-coordinate to start at.
+     *           int to_x: x-coordinate to get to.
+     *           int to_y: y-coordinate to get to.
+    ** Returns:  int: oxygen, or UNREACHABLE.
+    *********************************************************************/
+    int distance(int from_x, int from_y, int to_x, int to_y) const;
+
+
+    /********************************************************************
+    ** Function: component: Returns the component of a cell. Cells in
+     *              the same component can reach each other both ways.
+    ** Params:   int x: x-coordinate.
+     *           int y: y-coordinate.
+    ** Returns:  int: 0 up to componentCount, or -1 if the cell can't
+     *              be walked on.
+    *********************************************************************/
+    int component(int x, int y) const;
+
+
+    /********************************************************************
+    ** Function: componentCount: Returns how many components there are.
+    ** Params:   None
+    ** Returns:  int: number of components.
+    *********************************************************************/
+    int componentCount() const;
+
+};
+
+#endif
@@ -0,0 +1,236 @@
+/*********************************************************************
+** Program name: TravelerState.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 21, 2019 at 10:05 AM
+** Description: Class implementation file for TravelerState.
+ *              TravelerState is a compact copy of everything about
+ *              the traveler that changes during a game: coordinates,
+ *              health, oxygen, and how many items of each type they
+ *              carry. It is packed into a single 64-bit word, so it
+ *              is trivially copyable, compares and hashes as one
+ *              integer, and is meant to be stored in large numbers,
+ *              such as in a solver's hash table of visited states.
+ *              Coordinates take 16 bits each, so every cell of a
+ *              10000x10000 board has its own state. Item counts take
+ *              5 bits, more than an inventory can hold. Values that
+ *              don't fit their field are clamped.
+*********************************************************************/
+
+
+#include <type_traits>
+#include "TravelerState.hpp"
+#include "Human.hpp"
+
+//the whole state must stay one plain word
+static_assert(sizeof(TravelerState) == sizeof(std::uint64_t),
+              "TravelerState must pack into 8 bytes");
+static_assert(std::is_trivially_copyable<TravelerState>::value,
+              "TravelerState must be trivially copyable");
+
+//initialize field limits
+const int TravelerState::MAX_COORD = (1 << TravelerState::COORD_BITS) - 1;
+const int TravelerState::MAX_VALUE = (1 << TravelerState::VALUE_BITS) - 1;
+const int TravelerState::MAX_ITEMS = (1 << TravelerState::ITEM_BITS) - 1;
+
+/********************************************************************
+** Function: Hash::operator(): Returns the hash of a state.
+** Params:   const TravelerState &state: state to hash.
+** Returns:  size_t: hash of the state.
+*********************************************************************/
+std::size_t TravelerState::Hash::operator()(const TravelerState &state) const
+{
+    return state.hash();
+}
+
+
+/********************************************************************
+** Function: Constructor/default: Creates a state with every field
+ *              set to 0.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+TravelerState::TravelerState() : bits(0)
+{}
+
+
+/********************************************************************
+** Function: Constructor: Creates a state from its fields.
+** Params:   int x: x-coordinate.
+ *           int y: y-coordinate.
+ *           int health: health points.
+ *           int oxygen: oxygen level.
+ *           int health_packs: number of health packs.
+ *           int plutonium: number of pieces of plutonium ore.
+ *           int ship_parts: number of ship parts.
+** Returns:  None
+*********************************************************************/
+TravelerState::TravelerState(int x, int y, int health, int oxygen,
+                                int health_packs, int plutonium, int ship_parts)
+                : bits(0)
+{
+    pack(X_SHIFT, COORD_BITS, x);
+    pack(Y_SHIFT, COORD_BITS, y);
+    pack(HEALTH_SHIFT, VALUE_BITS, health);
+    pack(OXYGEN_SHIFT, VALUE_BITS, oxygen);
+    pack(ITEM_SHIFT + HEALTHPACK * ITEM_BITS, ITEM_BITS, health_packs);
+    pack(ITEM_SHIFT + PLUTONIUMORE * ITEM_BITS, ITEM_BITS, plutonium);
+    pack(ITEM_SHIFT + SHIPPART * ITEM_BITS, ITEM_BITS, ship_parts);
+}
+
+
+/********************************************************************
+** Function: Constructor: Captures the current state of a traveler.
+** Params:   const Human &traveler: traveler to capture.
+** Returns:  None
+*********************************************************************/
+TravelerState::TravelerState(const Human &traveler)
+                : TravelerState(traveler.getX(), traveler.getY(),
+                                traveler.getHealth(), traveler.getOxygen(),
+                                traveler.getInventory()->count(HEALTHPACK),
+                                traveler.getInventory()->count(PLUTONIUMORE),
+                                traveler.getInventory()->count(SHIPPART))
+{}
+
+
+/********************************************************************
+** Function: field: Reads a field out of the packed bits.
+** Params:   int shift: position of the field's lowest bit.
+ *           int width: number of bits in the field.
+** Returns:  int: value of the field.
+*********************************************************************/
+int TravelerState::field(int shift, int width) const
+{
+    return static_cast<int>((bits >> shift) & ((std::uint64_t(1) << width) - 1));
+}
+
+
+/********************************************************************
+** Function: pack: Clamps a value to a field's range and stores it
+ *              in the packed bits.
+** Params:   int shift: position of the field's lowest bit.
+ *           int width: number of bits in the field.
+ *           int value: value to store.
+** Returns:  None
+*********************************************************************/
+void TravelerState::pack(int shift, int width, int value)
+{
+    const std::uint64_t MASK = (std::uint64_t(1) << width) - 1;
+
+    //clamp into the field, a dead traveler's health is stored as 0
+    if (value < 0)
+    {
+        value = 0;
+    }
+    if (static_cast<std::uint64_t>(value) > MASK)
+    {
+        value = static_cast<int>(MASK);
+    }
+
+    bits = (bits & ~(MASK << shift)) | (static_cast<std::uint64_t>(value) << shift);
+}
+
+
+/********************************************************************
+** Function: getX: Returns the x-coordinate.
+** Params:   None
+** Returns:  int: x-coordinate.
+*********************************************************************/
+int TravelerState::getX() const
+{
+    return field(X_SHIFT, COORD_BITS);
+}
+
+
+/********************************************************************
+** Function: getY: Returns the y-coordinate.
+** Params:   None
+** Returns:  int: y-coordinate.
+*********************************************************************/
+int TravelerState::getY() const
+{
+    return field(Y_SHIFT, COORD_BITS);
+}
+
+
+/********************************************************************
+** Function: getHealth: Returns the health points.
+** Params:   None
+** Returns:  int: health points.
+*********************************************************************/
+int TravelerState::getHealth() const
+{
+    return field(HEALTH_SHIFT, VALUE_BITS);
+}
+
+
+/********************************************************************
+** Function: getOxygen: Returns the oxygen level.
+** Params:   None
+** Returns:  int: oxygen level.
+*********************************************************************/
+int TravelerState::getOxygen() const
+{
+    return field(OXYGEN_SHIFT, VALUE_BITS);
+}
+
+
+/********************************************************************
+** Function: count: Returns how many items of a type are carried.
+** Params:   ItemType type: type of item to count.
+** Returns:  int: count of specified item.
+*********************************************************************/
+int TravelerState::count(ItemType type) const
+{
+    return field(ITEM_SHIFT + type * ITEM_BITS, ITEM_BITS);
+}
+
+
+/********************************************************************
+** Function: getBits: Returns the packed state.
+** Params:   None
+** Returns:  uint64_t: all fields packed into one word.
+*********************************************************************/
+std::uint64_t TravelerState::getBits() const
+{
+    return bits;
+}
+
+
+/********************************************************************
+** Function: hash: Returns a well-mixed hash of the packed state,
+ *              so states that differ by one field still spread
+ *              across a hash table.
+** Params:   None
+** Returns:  size_t: hash of the state.
+*********************************************************************/
+std::size_t TravelerState::hash() const
+{
+    //splitmix64 finalizer
+    std::uint64_t mixed = bits;
+    mixed = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    mixed = (mixed ^ (mixed >> 27)) * 0x94d049bb133111ebULL;
+    mixed = mixed ^ (mixed >> 31);
+    return static_cast<std::size_t>(mixed);
+}
+
+
+/********************************************************************
+** Function: operator==: Checks if two states are the same.
+** Params:   const TravelerState &other: state to compare to.
+** Returns:  bool: True if every field is the same.
+*********************************************************************/
+bool TravelerState::operator==(const TravelerState &other) const
+{
+    return bits == other.bits;
+}
+
+
+/********************************************************************
+** Function: operator!=: Checks if two states are different.
+** Params:   const TravelerState &other: state to compare to.
+** Returns:  bool: True if any field is different.
+*********************************************************************/
+bool TravelerState::operator!=(const TravelerState &other) const
+{
+    return bits != other.bits;
+}
@@ -0,0 +1,193 @@
+/*********************************************************************
+** Program name: TravelerState.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 21, 2019 at 10:05 AM
+** Description: Class specification file for TravelerState.
+ *              TravelerState is a compact copy of everything about
+ *              the traveler that changes during a game: coordinates,
+ *              health, oxygen, and how many items of each type they
+ *              carry. It is packed into a single 64-bit word, so it
+ *              is trivially copyable, compares and hashes as one
+ *              integer, and is meant to be stored in large numbers,
+ *              such as in a solver's hash table of visited states.
+ *              Coordinates take 16 bits each, so every cell of a
+ *              10000x10000 board has its own state. Item counts take
+ *              5 bits, more than an inventory can hold. Values that
+ *              don't fit their field are clamped.
+*********************************************************************/
+
+
+#ifndef TRAVELER_STATE_HPP
+#define TRAVELER_STATE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include "GameDefaults.hpp"
+
+class Human;
+
+class TravelerState
+{
+public:
+    //largest coordinate, largest health or oxygen, and largest item
+    // count
+    static const int MAX_COORD;
+    static const int MAX_VALUE;
+    static const int MAX_ITEMS;
+
+    //hash function object, for unordered containers
+    struct Hash
+    {
+        std::size_t operator()(const TravelerState &state) const;
+    };
+
+private:
+    //field widths and positions in bits, from the lowest bit
+    enum
+    {
+        COORD_BITS = 16,
+        VALUE_BITS = 8,
+        ITEM_BITS = 5,
+        X_SHIFT = 0,
+        Y_SHIFT = X_SHIFT + COORD_BITS,
+        HEALTH_SHIFT = Y_SHIFT + COORD_BITS,
+        OXYGEN_SHIFT = HEALTH_SHIFT + VALUE_BITS,
+        ITEM_SHIFT = OXYGEN_SHIFT + VALUE_BITS
+    };
+
+    //one item count per type has to fit after the other fields
+    static_assert(ITEM_SHIFT + (SHIPPART + 1) * ITEM_BITS <= 64,
+                  "TravelerState item counts must fit in 64 bits");
+
+    std::uint64_t bits;
+
+
+    /********************************************************************
+    ** Function: field: Reads a field out of the packed bits.
+    ** Params:   int shift: position of the field's lowest bit.
+     *           int width: number of bits in the field.
+    ** Returns:  int: value of the field.
+    *********************************************************************/
+    int field(int shift, int width) const;
+
+
+    /********************************************************************
+    ** Function: pack: Clamps a value to a field's range and stores it
+     *              in the packed bits.
+    ** Params:   int shift: position of the field's lowest bit.
+     *           int width: number of bits in the field.
+     *           int value: value to store.
+    ** Returns:  None
+    *********************************************************************/
+    void pack(int shift, int width, int value);
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Creates a state with every field
+     *              set to 0.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    TravelerState();
+
+
+    /********************************************************************
+    ** Function: Constructor: Creates a state from its fields.
+    ** Params:   int x: x-coordinate.
+     *           int y: y-coordinate.
+     *           int health: health points.
+     *           int oxygen: oxygen level.
+     *           int health_packs: number of health packs.
+     *           int plutonium: number of pieces of plutonium ore.
+     *           int ship_parts: number of ship parts.
+    ** Returns:  None
+    *********************************************************************/
+    TravelerState(int x, int y, int health, int oxygen,
+                    int health_packs, int plutonium, int ship_parts);
+
+
+    /********************************************************************
+    ** Function: Constructor: Captures the current state of a traveler.
+    ** Params:   const Human &traveler: traveler to capture.
+    ** Returns:  None
+    *********************************************************************/
+    explicit TravelerState(const Human &traveler);
+
+
+    /********************************************************************
+    ** Function: getX: Returns the x-coordinate.
+    ** Params:   None
+    ** Returns:  int: x-coordinate.
+    *********************************************************************/
+    int getX() const;
+
+
+    /********************************************************************
+    ** Function: getY: Returns the y-coordinate.
+    ** Params:   None
+    ** Returns:  int: y-coordinate.
+    *********************************************************************/
+    int getY() const;
+
+
+    /********************************************************************
+    ** Function: getHealth: Returns the health points.
+    ** Params:   None
+    ** Returns:  int: health points.
+    *********************************************************************/
+    int getHealth() const;
+
+
+    /********************************************************************
+    ** Function: getOxygen: Returns the oxygen level.
+    ** Params:   None
+    ** Returns:  int: oxygen level.
+    *********************************************************************/
+    int getOxygen() const;
+
+
+    /********************************************************************
+    ** Function: count: Returns how many items of a type are carried.
+    ** Params:   ItemType type: type of item to count.
+    ** Returns:  int: count of specified item.
+    *********************************************************************/
+    int count(ItemType type) const;
+
+
+    /********************************************************************
+    ** Function: getBits: Returns the packed state.
+    ** Params:   None
+    ** Returns:  uint64_t: all fields packed into one word.
+    *********************************************************************/
+    std::uint64_t getBits() const;
+
+
+    /********************************************************************
+    ** Function: hash: Returns a well-mixed hash of the packed state,
+     *              so states that differ by one field still spread
+     *              across a hash table.
+    ** Params:   None
+    ** Returns:  size_t: hash of the state.
+    *********************************************************************/
+    std::size_t hash() const;
+
+
+    /********************************************************************
+    ** Function: operator==: Checks if two states are the same.
+    ** Params:   const TravelerState &other: state to compare to.
+    ** Returns:  bool: True if every field is the same.
+    *********************************************************************/
+    bool operator==(const TravelerState &other) const;
+
+
+    /********************************************************************
+    ** Function: operator!=: Checks if two states are different.
+    ** Params:   const TravelerState &other: state to compare to.
+    ** Returns:  bool: True if any field is different.
+    *********************************************************************/
+    bool operator!=(const TravelerState &other) const;
+
+};
+
+#endif
@@ -11,18 +11,120 @@
  *              input arguments.
  *              Currently only supports integer and float validation,
  *              others will be added eventually.
+ *              Input is read from the current IOBackend.
 *********************************************************************/
 
 
 #include "ValidateInput.hpp"
 
-using std::cout;
-using std::cin;
 using std::flush;
 using std::endl;
 using std::stringstream;
 using std::string;
 
+//initialize static input buffer
+string ValidateInput::line;
+
+/********************************************************************
+** Function: readInteger: reads a line and tries to parse all of it
+ *           as an integer.
+** Params:   int &out_num: set to the parsed integer
+** Returns:  bool: true if the whole line was an integer
+*********************************************************************/
+bool ValidateInput::readInteger(int &out_num)
+{
+    if (!getline(IOBackend::in(), line))
+    {
+        return false;       //getline failed
+    }
+
+    return parseInteger(line, out_num);
+}
+
+
+/********************************************************************
+** Function: parseInteger: parses a whole string as an integer
+ *           without building a stream. Accepts exactly what
+ *           reading the string with noskipws accepted: an
+ *           optional sign followed by digits and nothing else.
+ *           A lone sign reads as 0, and numbers too large for an
+ *           int are clamped to the int limits.
+** Params:   const std::string &text: string to parse
+ *           int &out_num: set to the parsed integer
+** Returns:  bool: true if the whole string was an integer
+*********************************************************************/
+bool ValidateInput::parseInteger(const string &text, int &out_num)
+{
+    //Input string is empty (they only pressed enter)
+    if (text.empty())
+    {
+        return false;
+    }
+
+    const char *cursor = text.data();
+    const char *end = cursor + text.length();
+
+    //Read the optional sign
+    bool negative = (*cursor == '-');
+    if (negative || *cursor == '+')
+    {
+        cursor++;
+    }
+
+    //Largest magnitude that still fits, one more for negatives
+    const unsigned long long LIMIT =
+            static_cast<unsigned long long>(std::numeric_limits<int>::max())
+            + (negative ? 1 : 0);
+
+    //Accumulate digits, once past the limit the value stays clamped
+    unsigned long long magnitude = 0;
+    for (; cursor != end; cursor++)
+    {
+        unsigned digit = static_cast<unsigned char>(*cursor) - '0';
+
+        //Anything other than a digit fails validation
+        if (digit > 9)
+        {
+            return false;
+        }
+
+        if (magnitude <= LIMIT)
+        {
+            magnitude = magnitude * 10 + digit;
+        }
+    }
+
+    if (magnitude > LIMIT)
+    {
+        magnitude = LIMIT;
+    }
+
+    out_num = negative ? static_cast<int>(-static_cast<long long>(magnitude))
+                       : static_cast<int>(magnitude);
+    return true;
+}
+
+
+/********************************************************************
+** Function: readLine: reads a line of input into the reused line
+ *           buffer, for input that is not just a number.
+** Params:   None
+** Returns:  const std::string &: the line, empty if getline failed
+*********************************************************************/
+const string &ValidateInput::readLine()
+{
+    if (!getline(IOBackend::in(), line))
+    {
+        line.clear();       //getline failed
+    }
+
+    //Clear error flags
+    IOBackend::in().clear();
+
+    return line;
+}
+
+
 /********************************************************************
 ** Function: validateInteger: validates user input to ensure it is
  *           an integer. Rejects floats.
@@ -33,36 +135,16 @@ int ValidateInput::validateInteger()
 {
     //Initialize with lowest possible int
     int out_num = std::numeric_limits<int>::min();
-    string input;
     bool valid;
 
     do
     {
-        valid = true;      //Reset valid flag to true
-        cout << "Enter an integer: " << flush;
+        IOBackend::out() << "Enter an integer: " << flush;
 
-        if (getline(cin, input))
-        {
-            //Put input into a string stream and attempt to
-            // insert into an int variable
-            stringstream ss(input);
-            ss >> std::noskipws >> out_num;
-
-            //If anything remains in the string stream,
-            // or if input string is empty (they only pressed enter)
-            // then validation failed
-            if (!ss.eof() || !input.length())
-            {
-                valid = false;
-            }
-        }
-        else
-        {
-            valid = false;          //getline failed
-        }
+        valid = readInteger(out_num);
 
         //Clear error flags
-        cin.clear();
+        IOBackend::in().clear();
 
     } while (!valid);
 
@@ -82,37 +164,17 @@ int ValidateInput::validateInteger(int range_start, int range_end)
 {
     //Initialize with lowest possible int
     int out_num = std::numeric_limits<int>::min();
-    string input;
     bool valid;
 
     do
     {
-        valid = true;       //Reset valid flag to true
-        cout << "Enter a number between "
+        IOBackend::out() << "Enter a number between "
             << range_start << " and " << range_end << ": " << flush;
 
-        if (getline(cin, input))
-        {
-            //Put input into a string stream and attempt to
-            // insert into an int variable
-            stringstream ss(input);
-            ss >> std::noskipws >> out_num;
-
-            //If anything remains in the string stream,
-            // or if input string is empty (they only pressed enter)
-            // then validation failed
-            if (!ss.eof() || !input.length())
-            {
-                valid = false;
-            }
-        }
-        else
-        {
-            valid = false;  //getline failed
-        }
+        valid = readInteger(out_num);
 
         //Clear error flags
-        cin.clear();
+        IOBackend::in().clear();
 
     } while (!valid || out_num < range_start || out_num > range_end);
 
@@ -132,69 +194,49 @@ int ValidateInput::validateInteger(const int * choices, int size)
 {
     //Initialize with lowest possible int
     int out_num = std::numeric_limits<int>::min();
-    string input;
     bool valid;             //Check for valid input type
     bool matched;           //Check if valid selection
 
     do
     {
-        valid = true;       //Reset valid flag to true
         matched = false;    //Reset matched flag to false
-        cout << "Enter an integer: " << flush;
+        IOBackend::out() << "Enter an integer: " << flush;
 
-        if (getline(cin, input))
-        {
-            //Put input into a string stream and attempt to
-            // insert into an int variable
-            stringstream ss(input);
-            ss >> std::noskipws >> out_num;
+        valid = readInteger(out_num);
 
-            //If anything remains in the string stream,
-            // or if input string is empty (they only pressed enter)
-            // then validation failed
-            if (!ss.eof() || !input.length())
+        //Check if input matches with valid choices
+        if (valid)
+        {
+            //Loop to compare valid choices with user input
+            for (int i=0; i<size; i++)
             {
-                valid = false;
+                if (choices[i] == out_num)
+                {
+                    matched = true;
+                    i = size;   //To break out of for loop
+                }
             }
 
-            //Check if input matches with valid choices
-            if (valid)
+            //Loop to inform user of valid choices
+            if (!matched)
             {
-                //Loop to compare valid choices with user input
+                IOBackend::out() << "Error: The number must be one of: ";
                 for (int i=0; i<size; i++)
                 {
-                    if (choices[i] == out_num)
-                    {
-                        matched = true;
-                        i = size;   //To break out of for loop
-                    }
-                }
+                    IOBackend::out() << choices[i];
 
-                //Loop to inform user of valid choices
-                if (!matched)
-                {
-                    cout << "Error: The number must be one of: ";
-                    for (int i=0; i<size; i++)
+                    //Separate by commas except for last choice
+                    if (i != size-1)
                     {
-                        cout << choices[i];
-
-                        //Separate by commas except for last choice
-                        if (i != size-1)
-                        {
-                            cout << ", ";
-                        }
+                        IOBackend::out() << ", ";
                     }
-                    cout << endl;
                 }
+                IOBackend::out() << endl;
             }
         }
-        else
-        {
-            valid = false;  //getline failed
-        }
 
         //Clear error flags
-        cin.clear();
+        IOBackend::in().clear();
 
     } while (!valid || !matched);
 
@@ -218,10 +260,10 @@ double ValidateInput::validateFloat()
     do
     {
         valid = true;      //Reset valid flag to true
-        cout << std::fixed << std::showpoint << std::setprecision(2)
+        IOBackend::out() << std::fixed << std::showpoint << std::setprecision(2)
              << "Enter an number: " << flush;
 
-        if (getline(cin, input))
+        if (getline(IOBackend::in(), input))
         {
             //Put input into a string stream and attempt to
             // insert into an int variable
@@ -242,7 +284,7 @@ double ValidateInput::validateFloat()
         }
 
         //Clear error flags
-        cin.clear();
+        IOBackend::in().clear();
 
     } while (!valid);
 
@@ -267,11 +309,11 @@ double ValidateInput::validateFloat(double range_start, double range_end)
     do
     {
         valid = true;       //Reset valid flag to true
-        cout << std::fixed << std::showpoint << std::setprecision(2)
+        IOBackend::out() << std::fixed << std::showpoint << std::setprecision(2)
              << "Enter a number between "
              << range_start << " and " << range_end << ": " << flush;
 
-        if (getline(cin, input))
+        if (getline(IOBackend::in(), input))
         {
             //Put input into a string stream and attempt to
             // insert into an int variable
@@ -292,7 +334,7 @@ double ValidateInput::validateFloat(double range_start, double range_end)
         }
 
         //Clear error flags
-        cin.clear();
+        IOBackend::in().clear();
 
     } while (!valid || out_num < range_start || out_num > range_end);
 
@@ -11,6 +11,7 @@
  *              input arguments.
  *              Currently only supports integer and float validation,
  *              others will be added eventually.
+ *              Input is read from the current IOBackend.
 *********************************************************************/
 
 
@@ -22,11 +23,49 @@
 #include <sstream>
 #include <string>
 #include <limits>
+#include "IOBackend.hpp"
 
 class ValidateInput
 {
+private:
+    //line read from the user, reused by every call so that reading
+    // input does not allocate once warm
+    static std::string line;
+
+
+    /********************************************************************
+    ** Function: readInteger: reads a line and tries to parse all of it
+     *           as an integer.
+    ** Params:   int &out_num: set to the parsed integer
+    ** Returns:  bool: true if the whole line was an integer
+    *********************************************************************/
+    static bool readInteger(int &out_num);
+
 public:
 
+    /********************************************************************
+    ** Function: parseInteger: parses a whole string as an integer
+     *           without building a stream. Accepts exactly what
+     *           reading the string with noskipws accepted: an
+     *           optional sign followed by digits and nothing else.
+     *           A lone sign reads as 0, and numbers too large for an
+     *           int are clamped to the int limits.
+    ** Params:   const std::string &text: string to parse
+     *           int &out_num: set to the parsed integer
+    ** Returns:  bool: true if the whole string was an integer
+    *********************************************************************/
+    static bool parseInteger(const std::string &text, int &out_num);
+
+
+    /********************************************************************
+    ** Function: readLine: reads a line of input into the reused line
+     *           buffer, for input that is not just a number.
+    ** Params:   None
+    ** Returns:  const std::string &: the line, empty if getline failed
+    *********************************************************************/
+    static const std::string &readLine();
+
+
     /********************************************************************
     ** Function: validateInteger: validates user input to ensure it is
      *           an integer. Rejects floats.
@@ -8,19 +8,30 @@
  *              anomaly that is a rift in the fabric of time and
  *              space. You can walk through the wormhole if you want.
  *              It will teleport you to a random location on the
- *              asteroid.
+ *              asteroid, picked from the TeleportTable of its board,
+ *              or to the other end if it is linked to another worm
+ *              hole.
 *********************************************************************/
 
 
 #include "Wormhole.hpp"
 
-using std::cout;
 using std::endl;
 using std::string;
 
+//initialize static prompts
+const string Wormhole::WALK_PROMPT = "Do you want to walk through the worm hole?";
+const string Wormhole::TELEPORT_MESSAGE = "You walked through the worm hole "
+                                          "and got teleported to a random location...";
+const string Wormhole::CLOSED_MESSAGE = "The worm hole flickers, but nothing happens.";
+const string Wormhole::LINK_MESSAGE = "You walked through the worm hole "
+                                      "and came out of the other end...";
+
 /********************************************************************
 ** Function: Constructor/default: Sets coordinates, type, description
- *              and icon. Seeds the random number generator.
+ *              and icon. Seeds the random number generator. The
+ *              worm hole starts out not linked and with no
+ *              destinations.
 ** Params:   int x: x-coordinate of this space.
  *              default = 0.
  *           int y: y-coordinate of this space.
@@ -35,7 +46,8 @@ using std::string;
 *********************************************************************/
 Wormhole::Wormhole(int x, int y, SpaceType type,
         string description, char icon)
-        : Space(x, y, type, description, icon)
+        : Space(x, y, type, description, icon), destinations(nullptr),
+          link_x(-1), link_y(-1)
 {
     //seed random number generator
     MyRandom::seed();
@@ -45,9 +57,11 @@ Wormhole::Wormhole(int x, int y, SpaceType type,
 /********************************************************************
 ** Function: interact: Prints the description of the worm hole. Asks
  *              the user if they want to walk through the worm hole
- *              and get teleported. Calculates random coordinates to
- *              teleport you to. Uses the traveler pointer to set
- *              your new coordinates on the asteroid.
+ *              and get teleported. Sends you to the other end of a
+ *              linked worm hole, or picks a random cell of the
+ *              board to teleport you to. Uses the traveler pointer
+ *              to set your new coordinates on the asteroid. You
+ *              stay put if there are no destinations.
 ** Params:   Human * traveler: Pointer to human object in which to
  *              interact with this space. Used to check your
  *              inventory.
@@ -61,29 +75,64 @@ bool Wormhole::interact(Human *traveler)
         menu.formatPrompt(getDesc());
 
         //ask user if they want to walk through the worm hole
-        const string WORMHOLE_PROMPT =
-                "Do you want to walk through the worm hole?";
-
-        if (menu.confirm(WORMHOLE_PROMPT) == Menu::YES)
+        if (menu.confirm(WALK_PROMPT) == Menu::YES)
         {
-            //initialize constants
-            const int LOWER = 0;
-            const int UPPER = 9;
-
-            //print that you walked through the worm hole
-            // and got teleported to a random location
-            menu.formatPrompt("You walked through the worm hole "
-                    "and got teleported to a random location...");
-
-            //generate random coordinates
-            int new_x = MyRandom::randomInteger(LOWER, UPPER);
-            int new_y = MyRandom::randomInteger(LOWER, UPPER);
-
-            //set traveler's new coordinates
-            traveler->setX(new_x);
-            traveler->setY(new_y);
+            //initialize variables to hold the new coordinates
+            int new_x = 0;
+            int new_y = 0;
+
+            //a linked worm hole always leads to the other end
+            if (link_x >= 0)
+            {
+                menu.formatPrompt(LINK_MESSAGE);
+
+                traveler->setX(link_x);
+                traveler->setY(link_y);
+            }
+            //pick a random cell of the board
+            else if (destinations && destinations->pick(new_x, new_y))
+            {
+                //print that you walked through the worm hole
+                // and got teleported to a random location
+                menu.formatPrompt(TELEPORT_MESSAGE);
+
+                //set traveler's new coordinates
+                traveler->setX(new_x);
+                traveler->setY(new_y);
+            }
+            else
+            {
+                menu.formatPrompt(CLOSED_MESSAGE);
+            }
         }
     }
 
     return false;
 }
+
+
+/********************************************************************
+** Function: setDestinations: Sets the table this worm hole picks
+ *              its destinations from.
+** Params:   TeleportTable *table: table of the worm hole's board,
+ *              not owned, or nullptr for no destinations.
+** Returns:  None
+*********************************************************************/
+void Wormhole::setDestinations(TeleportTable *table)
+{
+    destinations = table;
+}
+
+
+/********************************************************************
+** Function: setLink: Links this worm hole to a cell, so walking
+ *              through it always leads there.
+** Params:   int x: x-coordinate of the other end.
+ *           int y: y-coordinate of the other end.
+** Returns:  None
+*********************************************************************/
+void Wormhole::setLink(int x, int y)
+{
+    link_x = x;
+    link_y = y;
+}
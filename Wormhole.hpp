@@ -8,7 +8,9 @@
  *              anomaly that is a rift in the fabric of time and
  *              space. You can walk through the wormhole if you want.
  *              It will teleport you to a random location on the
- *              asteroid.
+ *              asteroid, picked from the TeleportTable of its board,
+ *              or to the other end if it is linked to another worm
+ *              hole.
 *********************************************************************/
 
 
@@ -19,14 +21,31 @@
 #include <string>
 #include "MyRandom.hpp"
 #include "Space.hpp"
+#include "TeleportTable.hpp"
 
 class Wormhole : public Space
 {
+private:
+    //prompts for walking through the worm hole
+    static const std::string WALK_PROMPT;
+    static const std::string TELEPORT_MESSAGE;
+    static const std::string CLOSED_MESSAGE;
+    static const std::string LINK_MESSAGE;
+
+    //where this worm hole sends you, the table of its board, not owned
+    TeleportTable *destinations;
+
+    //coordinates of the other end, -1 if not linked
+    int link_x;
+    int link_y;
+
 public:
 
     /********************************************************************
     ** Function: Constructor/default: Sets coordinates, type, description
-     *              and icon. Seeds the random number generator.
+     *              and icon. Seeds the random number generator. The
+     *              worm hole starts out not linked and with no
+     *              destinations.
     ** Params:   int x: x-coordinate of this space.
      *              default = 0.
      *           int y: y-coordinate of this space.
@@ -49,9 +68,11 @@ public:
     /********************************************************************
     ** Function: interact: Prints the description of the worm hole. Asks
      *              the user if they want to walk through the worm hole
-     *              and get teleported. Calculates random coordinates to
-     *              teleport you to. Uses the traveler pointer to set
-     *              your new coordinates on the asteroid.
+     *              and get teleported. Sends you to the other end of a
+     *              linked worm hole, or picks a random cell of the
+     *              board to teleport you to. Uses the traveler pointer
+     *              to set your new coordinates on the asteroid. You
+     *              stay put if there are no destinations.
     ** Params:   Human * traveler: Pointer to human object in which to
      *              interact with this space. Used to check your
      *              inventory.
@@ -59,6 +80,26 @@ public:
     *********************************************************************/
     virtual bool interact(Human *traveler = nullptr) override;
 
+
+    /********************************************************************
+    ** Function: setDestinations: Sets the table this worm hole picks
+     *              its destinations from.
+    ** Params:   TeleportTable *table: table of the worm hole's board,
+     *              not owned, or nullptr for no destinations.
+    ** Returns:  None
+    *********************************************************************/
+    void setDestinations(TeleportTable *table);
+
+
+    /********************************************************************
+    ** Function: setLink: Links this worm hole to a cell, so walking
+     *              through it always leads there.
+    ** Params:   int x: x-coordinate of the other end.
+     *           int y: y-coordinate of the other end.
+    ** Returns:  None
+    *********************************************************************/
+    void setLink(int x, int y);
+
 };
 
 #endif
@@ -0,0 +1,191 @@
+/*********************************************************************
+** Program name: bench_aliens.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 21, 2019 at 3:30 PM
+** Description: Roaming alien benchmark for Space Escape. Steps an
+ *              AlienSwarm on boards from 10x10 up to 4096x4096, with
+ *              a target walking back and forth across the middle of
+ *              the board, and reports the time per step and per
+ *              alien, and how many attacks happened. Then does the
+ *              same with the aliens hunting the target, reporting
+ *              how long the FlowField takes to update for each step
+ *              of the target compared to searching the whole board
+ *              again, and how long the aliens take to follow it.
+ *              Usage: bench_aliens [aliens] [steps per size]
+ *              (defaults: 100000 aliens, 2000 steps)
+*********************************************************************/
+
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "AlienSwarm.hpp"
+#include "FlowField.hpp"
+#include "BlockerMap.hpp"
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef std::chrono::steady_clock Clock;
+
+/********************************************************************
+** Function: secondsSince: Returns the time since a starting point.
+** Params:   Clock::time_point begin: starting point.
+** Returns:  double: seconds since begin.
+*********************************************************************/
+static double secondsSince(Clock::time_point begin)
+{
+    return std::chrono::duration<double>(Clock::now() - begin).count();
+}
+
+
+/********************************************************************
+** Function: pace: Moves a target one cell along the middle row,
+ *              turning around at the edges.
+** Params:   int size: width of the board.
+ *           int &target_x: x-coordinate of the target.
+ *           int &heading: 1 to go right, -1 to go left.
+** Returns:  None
+*********************************************************************/
+static void pace(int size, int &target_x, int &heading)
+{
+    if (target_x + heading < 0 || target_x + heading >= size)
+    {
+        heading = -heading;
+    }
+    target_x += heading;
+}
+
+
+/********************************************************************
+** Function: openBoard: Opens every cell of a blocker map, so the
+ *              aliens can go anywhere.
+** Params:   BlockerMap &blockers: map to open.
+** Returns:  None
+*********************************************************************/
+static void openBoard(BlockerMap &blockers)
+{
+    for (int y=0; y<blockers.getRows(); y++)
+    {
+        for (int x=0; x<blockers.getCols(); x++)
+        {
+            blockers.setBlocked(x, y, false);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int count = (argc > 1) ? std::atoi(argv[1]) : 100000;
+    int steps = (argc > 2) ? std::atoi(argv[2]) : 2000;
+
+    if (count < 1 || steps < 1)
+    {
+        std::cerr << "Usage: bench_aliens [aliens] [steps per size]" << endl;
+        return 1;
+    }
+
+    const int SIZES[] = {10, 100, 1024, 4096};
+    const int SIZES_COUNT = 4;
+    const unsigned int SEED = 12345;
+
+    cout << count << " aliens, " << steps << " steps per board" << endl;
+    cout << std::left << setw(14) << "board" << std::right
+         << setw(14) << "us/step"
+         << setw(14) << "ns/alien"
+         << setw(12) << "attacks" << endl;
+
+    for (int i=0; i<SIZES_COUNT; i++)
+    {
+        int size = SIZES[i];
+        BlockerMap blockers(size, size);
+        openBoard(blockers);
+        AlienSwarm swarm(blockers, count, SEED);
+
+        //the target paces along the middle row
+        int target_x = 0;
+        int target_y = size / 2;
+        int heading = 1;
+        long attacks = 0;
+
+        Clock::time_point begin = Clock::now();
+        for (int step=0; step<steps; step++)
+        {
+            attacks += swarm.step(target_x, target_y);
+            pace(size, target_x, heading);
+        }
+        double seconds = secondsSince(begin);
+
+        cout << std::left << setw(14)
+             << (std::to_string(size) + "x" + std::to_string(size)) << std::right
+             << std::fixed << std::setprecision(1)
+             << setw(14) << (seconds * 1e6 / steps)
+             << setw(14) << std::setprecision(2)
+             << (seconds * 1e9 / steps / count)
+             << setw(12) << attacks << endl;
+    }
+
+    cout << endl << "hunting, flow field updated every step" << endl;
+    cout << std::left << setw(14) << "board" << std::right
+         << setw(14) << "search us"
+         << setw(14) << "update us"
+         << setw(14) << "hunt us"
+         << setw(12) << "attacks" << endl;
+
+    for (int i=0; i<SIZES_COUNT; i++)
+    {
+        int size = SIZES[i];
+        int target_x = 0;
+        int target_y = size / 2;
+        int heading = 1;
+        long attacks = 0;
+
+        //searching again: jump between two far apart cells
+        FlowField field(size, size, 0, 0);
+        int searches = (size > 1000) ? 20 : 200;
+        Clock::time_point begin = Clock::now();
+        for (int step=0; step<searches; step++)
+        {
+            field.moveTarget((step & 1) * (size - 1), target_y);
+        }
+        double search_seconds = secondsSince(begin) / searches;
+
+        //walk one cell at a time, timing the field update and the
+        // aliens following it separately. Large boards get fewer steps,
+        // since each update touches about half the board.
+        int hunt_steps = (size > 1000) ? 20 : steps;
+        double update_seconds = 0;
+        double hunt_seconds = 0;
+        BlockerMap blockers(size, size);
+        openBoard(blockers);
+        AlienSwarm swarm(blockers, count, SEED);
+        field.moveTarget(target_x, target_y);
+
+        for (int step=0; step<hunt_steps; step++)
+        {
+            pace(size, target_x, heading);
+
+            begin = Clock::now();
+            field.moveTarget(target_x, target_y);
+            update_seconds += secondsSince(begin);
+
+            begin = Clock::now();
+            attacks += swarm.hunt(field, target_x, target_y);
+            hunt_seconds += secondsSince(begin);
+        }
+        update_seconds /= hunt_steps;
+        hunt_seconds /= hunt_steps;
+
+        cout << std::left << setw(14)
+             << (std::to_string(size) + "x" + std::to_string(size)) << std::right
+             << std::fixed << std::setprecision(1)
+             << setw(14) << (search_seconds * 1e6)
+             << setw(14) << (update_seconds * 1e6)
+             << setw(14) << (hunt_seconds * 1e6)
+             << setw(12) << attacks << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+/*********************************************************************
+** Program name: bench_events.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 22, 2019 at 4:40 PM
+** Description: Scheduled event benchmark for Space Escape. Schedules
+ *              events at random delays, a tenth of them repeating,
+ *              and steps until every one-time event has fired, once
+ *              with a TimerWheel and once with a plain list that is
+ *              scanned for due events every step. Reports the time
+ *              per step and per event fired for both.
+ *              Usage: bench_events [events] [longest delay]
+ *              (defaults: 100000 events, 2000 steps)
+*********************************************************************/
+
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "TimerWheel.hpp"
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef std::chrono::steady_clock Clock;
+
+//an event waiting in the plain list
+struct Pending
+{
+    TimerWheel::Event event;
+    long when;
+    int period;
+};
+
+/********************************************************************
+** Function: secondsSince: Returns the time since a starting point.
+** Params:   Clock::time_point begin: starting point.
+** Returns:  double: seconds since begin.
+*********************************************************************/
+static double secondsSince(Clock::time_point begin)
+{
+    return std::chrono::duration<double>(Clock::now() - begin).count();
+}
+
+
+/********************************************************************
+** Function: scanStep: Fires the due events of a plain list by
+ *              looking at every one of them, as a game without a
+ *              timer wheel would.
+** Params:   vector<Pending> &events: events waiting, fired one-time
+ *              events are removed.
+ *           long now: current step.
+** Returns:  long: number of events fired.
+*********************************************************************/
+static long scanStep(std::vector<Pending> &events, long now)
+{
+    long count = 0;
+
+    for (std::size_t i=0; i<events.size(); )
+    {
+        if (events[i].when == now)
+        {
+            count++;
+            if (events[i].period > 0)
+            {
+                events[i].when += events[i].period;
+            }
+            else
+            {
+                //order doesn't matter, fill the gap with the last one
+                events[i] = events.back();
+                events.pop_back();
+                continue;
+            }
+        }
+        i++;
+    }
+
+    return count;
+}
+
+int main(int argc, char *argv[])
+{
+    int count = (argc > 1) ? std::atoi(argv[1]) : 100000;
+    int longest = (argc > 2) ? std::atoi(argv[2]) : 2000;
+
+    if (count < 1 || longest < 1)
+    {
+        std::cerr << "Usage: bench_events [events] [longest delay]" << endl;
+        return 1;
+    }
+
+    //the same random delays for both
+    std::srand(12345);
+    std::vector<int> delays(count);
+    std::vector<int> periods(count);
+    for (int i=0; i<count; i++)
+    {
+        delays[i] = 1 + std::rand() % longest;
+        periods[i] = (i % 10 == 0) ? 1 + std::rand() % 100 : 0;
+    }
+
+    cout << count << " events, delays up to " << longest << " steps" << endl;
+    cout << std::left << setw(14) << "scheduler" << std::right
+         << setw(14) << "schedule ms"
+         << setw(14) << "us/step"
+         << setw(14) << "ns/event"
+         << setw(12) << "fired" << endl;
+
+    //timer wheel
+    {
+        TimerWheel wheel(count);
+        Clock::time_point begin = Clock::now();
+        for (int i=0; i<count; i++)
+        {
+            TimerWheel::Event event = {0, i, 0, 0};
+            wheel.schedule(delays[i], event, periods[i]);
+        }
+        double schedule_seconds = secondsSince(begin);
+
+        long fired = 0;
+        begin = Clock::now();
+        for (int step=0; step<longest; step++)
+        {
+            fired += wheel.advance();
+        }
+        double seconds = secondsSince(begin);
+
+        cout << std::left << setw(14) << "timer wheel" << std::right
+             << std::fixed << std::setprecision(2)
+             << setw(14) << (schedule_seconds * 1e3)
+             << setw(14) << (seconds * 1e6 / longest)
+             << setw(14) << (seconds * 1e9 / fired)
+             << setw(12) << fired << endl;
+    }
+
+    //plain list scanned every step
+    {
+        std::vector<Pending> events;
+        events.reserve(count);
+        Clock::time_point begin = Clock::now();
+        for (int i=0; i<count; i++)
+        {
+            Pending pending = {{0, i, 0, 0}, delays[i], periods[i]};
+            events.push_back(pending);
+        }
+        double schedule_seconds = secondsSince(begin);
+
+        long fired = 0;
+        begin = Clock::now();
+        for (int step=1; step<=longest; step++)
+        {
+            fired += scanStep(events, step);
+        }
+        double seconds = secondsSince(begin);
+
+        cout << std::left << setw(14) << "scan" << std::right
+             << std::fixed << std::setprecision(2)
+             << setw(14) << (schedule_seconds * 1e3)
+             << setw(14) << (seconds * 1e6 / longest)
+             << setw(14) << (seconds * 1e9 / fired)
+             << setw(12) << fired << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,224 @@
+/*********************************************************************
+** Program name: bench_hpa.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 26, 2019 at 2:30 PM
+** Description: Hierarchical pathfinding benchmark for Space Escape.
+ *              Fills a board with random space types, each cell
+ *              costing the oxygen of its type, and scatters blocked
+ *              fields of boulders over it. Reports how long it takes
+ *              to build a PathHierarchy, to plan random trips across
+ *              the board and refine their legs, and to update
+ *              it after a tile changes. On a smaller board it also
+ *              plans the same trips with a CostField, to report how
+ *              much more oxygen the planned trips cost than the
+ *              cheapest ones.
+ *              Usage: bench_hpa [board size] [trips]
+ *              (defaults: 10000x10000 board, 1000 trips)
+*********************************************************************/
+
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "PathHierarchy.hpp"
+#include "CostField.hpp"
+#include "GameDefaults.hpp"
+
+using std::cout;
+using std::endl;
+
+typedef std::chrono::steady_clock Clock;
+
+/********************************************************************
+** Function: secondsSince: Returns the time since a starting point.
+** Params:   Clock::time_point begin: starting point.
+** Returns:  double: seconds since begin.
+*********************************************************************/
+static double secondsSince(Clock::time_point begin)
+{
+    return std::chrono::duration<double>(Clock::now() - begin).count();
+}
+
+
+/********************************************************************
+** Function: makeTerrain: Fills a board with random space types and
+ *              blocked fields of boulders.
+** Params:   vector<unsigned char> &costs: set to the cost of each
+ *              cell, row by row.
+ *           int size: number of rows and columns.
+** Returns:  None
+*********************************************************************/
+static void makeTerrain(std::vector<unsigned char> &costs, int size)
+{
+    costs.assign(static_cast<std::size_t>(size) * size, 1);
+
+    for (std::size_t i=0; i<costs.size(); i++)
+    {
+        const GameDefaults::SpaceConfig &config = SPACE_CONFIG_LT[std::rand() % GameDefaults::DEFAULTSPACE];
+        costs[i] = config.passable ? config.oxygen_cost : 0;
+    }
+
+    //about a tenth of the board is blocked, in fields up to 20 wide
+    long fields = static_cast<long>(size) * size / 1000;
+    for (long i=0; i<fields; i++)
+    {
+        int left = std::rand() % size;
+        int top = std::rand() % size;
+        int width = 1 + std::rand() % 20;
+        int height = 1 + std::rand() % 20;
+
+        for (int y=top; y<top + height && y<size; y++)
+        {
+            for (int x=left; x<left + width && x<size; x++)
+            {
+                costs[static_cast<std::size_t>(y) * size + x] = 0;
+            }
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: build: Builds a hierarchy from a list of costs.
+** Params:   PathHierarchy &paths: hierarchy of the same size.
+ *           const vector<unsigned char> &costs: cost of each cell.
+ *           int size: number of rows and columns.
+** Returns:  None
+*********************************************************************/
+static void build(PathHierarchy &paths, const std::vector<unsigned char> &costs, int size)
+{
+    for (int y=0; y<size; y++)
+    {
+        for (int x=0; x<size; x++)
+        {
+            paths.setCost(x, y, costs[static_cast<std::size_t>(y) * size + x]);
+        }
+    }
+    paths.update();
+}
+
+int main(int argc, char *argv[])
+{
+    int size = (argc > 1) ? std::atoi(argv[1]) : 10000;
+    int trips = (argc > 2) ? std::atoi(argv[2]) : 1000;
+
+    if (size < 2 || trips < 1)
+    {
+        std::cerr << "Usage: bench_hpa [board size] [trips]" << endl;
+        return 1;
+    }
+
+    std::srand(12345);
+    cout << std::fixed << std::setprecision(3);
+
+    std::vector<unsigned char> costs;
+    makeTerrain(costs, size);
+
+    PathHierarchy paths(size, size);
+    Clock::time_point begin = Clock::now();
+    build(paths, costs, size);
+    cout << size << "x" << size << " board, "
+         << paths.entranceCount() << " entrances, built in "
+         << secondsSince(begin) << " s" << endl;
+
+    //trips between random cells that can be walked on
+    double plan_seconds = 0;
+    double worst_seconds = 0;
+    double refine_seconds = 0;
+    int found = 0;
+    long legs = 0;
+    std::vector<int> cells;
+
+    for (int i=0; i<trips; i++)
+    {
+        int from = 0;
+        int to = 0;
+        do
+        {
+            from = std::rand() % (size * size);
+            to = std::rand() % (size * size);
+        } while (!costs[from] || !costs[to]);
+
+        begin = Clock::now();
+        int oxygen = paths.plan(from % size, from / size, to % size, to / size);
+        double seconds = secondsSince(begin);
+        plan_seconds += seconds;
+        worst_seconds = (seconds > worst_seconds) ? seconds : worst_seconds;
+
+        if (oxygen != PathHierarchy::UNREACHABLE)
+        {
+            found++;
+            cells.clear();
+            begin = Clock::now();
+            for (int leg=0; leg<paths.legCount(); leg++)
+            {
+                paths.refine(leg, cells);
+            }
+            refine_seconds += secondsSince(begin);
+            legs += paths.legCount();
+        }
+    }
+
+    cout << trips << " trips, " << found << " found" << endl;
+    cout << "plan:         " << (plan_seconds * 1e3 / trips) << " ms average, "
+         << (worst_seconds * 1e3) << " ms worst" << endl;
+    cout << "refine:       " << (refine_seconds * 1e3 / (legs ? legs : 1))
+         << " ms average leg, " << (refine_seconds * 1e3 / (found ? found : 1))
+         << " ms average trip" << endl;
+
+    //one tile changes, then the next trip is planned
+    double update_seconds = 0;
+    int rebuilt = 0;
+    const int CHANGES = 100;
+    for (int i=0; i<CHANGES; i++)
+    {
+        paths.setCost(std::rand() % size, std::rand() % size, std::rand() % 3);
+
+        begin = Clock::now();
+        rebuilt += paths.update();
+        update_seconds += secondsSince(begin);
+    }
+    cout << "tile change:  " << (update_seconds * 1e3 / CHANGES) << " ms average, "
+         << (static_cast<double>(rebuilt) / CHANGES) << " clusters worked out" << endl;
+
+    //how close the planned trips are to the cheapest ones
+    const int CHECK_SIZE = (size < 1024) ? size : 1024;
+    const int CHECK_TRIPS = 50;
+    makeTerrain(costs, CHECK_SIZE);
+
+    PathHierarchy small_paths(CHECK_SIZE, CHECK_SIZE);
+    CostField field(CHECK_SIZE, CHECK_SIZE);
+    build(small_paths, costs, CHECK_SIZE);
+    for (int y=0; y<CHECK_SIZE; y++)
+    {
+        for (int x=0; x<CHECK_SIZE; x++)
+        {
+            field.setCost(x, y, costs[y * CHECK_SIZE + x]);
+        }
+    }
+
+    double planned = 0;
+    double cheapest = 0;
+    for (int i=0; i<CHECK_TRIPS; i++)
+    {
+        int from_x = std::rand() % CHECK_SIZE;
+        int from_y = std::rand() % CHECK_SIZE;
+        int to_x = std::rand() % CHECK_SIZE;
+        int to_y = std::rand() % CHECK_SIZE;
+
+        int oxygen = small_paths.plan(from_x, from_y, to_x, to_y);
+        field.search(from_x, from_y);
+        if (oxygen != PathHierarchy::UNREACHABLE)
+        {
+            planned += oxygen;
+            cheapest += field.distance(to_x, to_y);
+        }
+    }
+    cout << "on " << CHECK_SIZE << "x" << CHECK_SIZE << ", planned trips cost "
+         << ((cheapest > 0) ? (planned / cheapest - 1) * 100 : 0)
+         << "% more oxygen than the cheapest" << endl;
+
+    return 0;
+}
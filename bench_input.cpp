@@ -0,0 +1,202 @@
+/*********************************************************************
+** Program name: bench_input.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 17, 2019 at 10:05 AM
+** Description: Input parsing benchmark for Space Escape. Reads a
+ *              large batch of input lines the way ValidateInput used
+ *              to (a fresh string and stringstream per line) and the
+ *              way it does now (one reused line and parseInteger),
+ *              and reports the cost per line of each. Before timing,
+ *              every line and a list of edge cases are parsed both
+ *              ways to check that they accept the same input and
+ *              produce the same numbers.
+ *              Usage: bench_input [lines]
+ *              (default: 1000000 lines)
+*********************************************************************/
+
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "MyRandom.hpp"
+#include "ValidateInput.hpp"
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::string;
+
+typedef std::chrono::steady_clock Clock;
+
+/********************************************************************
+** Function: streamParse: Parses a line the way ValidateInput did
+ *              before parseInteger, with a stringstream.
+** Params:   const string &input: line to parse.
+ *           int &out_num: set to the parsed integer.
+** Returns:  bool: true if the whole line was an integer.
+*********************************************************************/
+static bool streamParse(const string &input, int &out_num)
+{
+    std::stringstream ss(input);
+    ss >> std::noskipws >> out_num;
+    return ss.eof() && input.length();
+}
+
+
+/********************************************************************
+** Function: randomLine: Makes up a line a user or script might type.
+ *              Mostly menu choices, with some larger numbers, signs,
+ *              overflow, and typos mixed in.
+** Params:   None
+** Returns:  string: the line.
+*********************************************************************/
+static string randomLine()
+{
+    const char *TYPOS[] = {"", " 3", "4 ", "y", "2x", "-", "+", "+-1",
+                           "1.5", "0x10", "99999999999999999999"};
+    const int TYPOS_COUNT = 11;
+
+    int kind = MyRandom::randomInteger(1, 10);
+
+    if (kind <= 6)
+    {
+        //menu choice
+        return std::to_string(MyRandom::randomInteger(0, 6));
+    }
+    else if (kind <= 8)
+    {
+        //any int, maybe signed
+        string sign = (MyRandom::randomInteger(0, 1) ? "+" : "");
+        return sign + std::to_string(MyRandom::randomInteger(-1000000, 1000000));
+    }
+
+    return TYPOS[MyRandom::randomInteger(0, TYPOS_COUNT - 1)];
+}
+
+
+/********************************************************************
+** Function: agrees: Checks that both parsers give the same answer
+ *              for a line, and prints the line if they don't.
+** Params:   const string &input: line to check.
+** Returns:  bool: true if both parsers agree.
+*********************************************************************/
+static bool agrees(const string &input)
+{
+    int stream_num = 0;
+    int fast_num = 0;
+    bool stream_valid = streamParse(input, stream_num);
+    bool fast_valid = ValidateInput::parseInteger(input, fast_num);
+
+    if (stream_valid != fast_valid || (stream_valid && stream_num != fast_num))
+    {
+        cout << "Mismatch on \"" << input << "\": stream "
+             << stream_valid << "/" << stream_num << ", parseInteger "
+             << fast_valid << "/" << fast_num << endl;
+        return false;
+    }
+    return true;
+}
+
+
+int main(int argc, char *argv[])
+{
+    //number of lines to parse
+    long line_count = (argc > 1) ? std::atol(argv[1]) : 1000000;
+
+    //build the input all at once, like a piped session
+    string text;
+    for (long i=0; i<line_count; i++)
+    {
+        text += randomLine();
+        text += '\n';
+    }
+
+    //check that the parsers agree on edge cases and on every line
+    const char *EDGE_CASES[] = {"", "-", "+", " ", "0", "-0", "+0", "007",
+                                "2147483647", "2147483648", "-2147483648",
+                                "-2147483649", "4294967296", "-4294967297",
+                                "18446744073709551617", "+-5", "--5", "5-",
+                                " 5", "5 ", "5\r", "\t5", "1e3", "0x1"};
+    const int EDGE_CASES_COUNT = 24;
+
+    bool same = true;
+    for (int i=0; i<EDGE_CASES_COUNT; i++)
+    {
+        same = agrees(EDGE_CASES[i]) && same;
+    }
+
+    std::istringstream check_in(text);
+    string check_line;
+    while (getline(check_in, check_line))
+    {
+        same = agrees(check_line) && same;
+    }
+
+    if (!same)
+    {
+        return 1;
+    }
+    cout << "Parsers agree on " << line_count << " lines and "
+         << EDGE_CASES_COUNT << " edge cases." << endl;
+
+    //sum of the parsed numbers, so the work can't be optimized away
+    long long stream_sum = 0;
+    long long fast_sum = 0;
+
+    //old: a fresh string and stringstream for every line
+    std::istringstream stream_in(text);
+    Clock::time_point begin = Clock::now();
+    while (true)
+    {
+        string input;
+        if (!getline(stream_in, input))
+        {
+            break;
+        }
+
+        int out_num = 0;
+        if (streamParse(input, out_num))
+        {
+            stream_sum += out_num;
+        }
+    }
+    double stream_seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+
+    //new: one reused line and parseInteger
+    std::istringstream fast_in(text);
+    string line;
+    begin = Clock::now();
+    while (getline(fast_in, line))
+    {
+        int out_num = 0;
+        if (ValidateInput::parseInteger(line, out_num))
+        {
+            fast_sum += out_num;
+        }
+    }
+    double fast_seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+
+    if (stream_sum != fast_sum)
+    {
+        cout << "Sums differ: " << stream_sum << " vs " << fast_sum << endl;
+        return 1;
+    }
+
+    cout << std::left << setw(16) << "parser" << std::right
+         << setw(14) << "ns/line"
+         << setw(16) << "lines/sec" << endl;
+
+    cout << std::fixed << std::setprecision(1);
+    cout << std::left << setw(16) << "stringstream" << std::right
+         << setw(14) << stream_seconds * 1e9 / line_count
+         << setw(16) << line_count / stream_seconds << endl;
+    cout << std::left << setw(16) << "parseInteger" << std::right
+         << setw(14) << fast_seconds * 1e9 / line_count
+         << setw(16) << line_count / fast_seconds << endl;
+    cout << "Speedup: " << stream_seconds / fast_seconds << "x" << endl;
+
+    return 0;
+}
@@ -0,0 +1,292 @@
+/*********************************************************************
+** Program name: bench_jps.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 27, 2019 at 11:15 AM
+** Description: Jump Point Search benchmark for Space Escape. Fills
+ *              boards from 256x256 up to 4096x4096 with mostly open
+ *              ground and scatters blocked fields of chasms over it,
+ *              then finds the fewest steps between random cells
+ *              three ways: a breadth first search, plain A* on a
+ *              binary heap, and a JumpPointSearch. Reports the time
+ *              per trip and the cells or jump points each one looked
+ *              past, and checks that they all agree on the steps.
+ *              Usage: bench_jps [trips per size]
+ *              (default: 20 trips)
+*********************************************************************/
+
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+#include "JumpPointSearch.hpp"
+#include "BlockerMap.hpp"
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef std::chrono::steady_clock Clock;
+
+//a cell waiting in the heap, with its estimate
+typedef std::pair<int, int> Waiting;
+
+/********************************************************************
+** Function: secondsSince: Returns the time since a starting point.
+** Params:   Clock::time_point begin: starting point.
+** Returns:  double: seconds since begin.
+*********************************************************************/
+static double secondsSince(Clock::time_point begin)
+{
+    return std::chrono::duration<double>(Clock::now() - begin).count();
+}
+
+
+/********************************************************************
+** Function: breadthFirst: Finds the fewest steps between two cells
+ *              with a breadth first search that stops at the goal.
+** Params:   const vector<unsigned char> &blocked: 1 for each cell
+ *              that can't be walked on, row by row.
+ *           int size: number of rows and columns.
+ *           int start: cell to start at.
+ *           int goal: cell to get to.
+ *           vector<int> &steps: steps of each cell, reused.
+ *           long &looked: set to the cells taken off the queue.
+** Returns:  int: number of steps, or -1.
+*********************************************************************/
+static int breadthFirst(const std::vector<unsigned char> &blocked, int size,
+                        int start, int goal, std::vector<int> &steps, long &looked)
+{
+    std::queue<int> waiting;
+
+    steps.assign(blocked.size(), -1);
+    steps[start] = 0;
+    waiting.push(start);
+    looked = 0;
+
+    while (!waiting.empty())
+    {
+        int here = waiting.front();
+        waiting.pop();
+        looked++;
+
+        if (here == goal)
+        {
+            return steps[here];
+        }
+
+        int x = here % size;
+        int y = here / size;
+        const int NEIGHBOR_X[] = {x, x + 1, x, x - 1};
+        const int NEIGHBOR_Y[] = {y - 1, y, y + 1, y};
+
+        for (int k=0; k<4; k++)
+        {
+            if (NEIGHBOR_X[k] < 0 || NEIGHBOR_X[k] >= size
+                || NEIGHBOR_Y[k] < 0 || NEIGHBOR_Y[k] >= size)
+            {
+                continue;
+            }
+
+            int neighbor = NEIGHBOR_Y[k] * size + NEIGHBOR_X[k];
+            if (!blocked[neighbor] && steps[neighbor] == -1)
+            {
+                steps[neighbor] = steps[here] + 1;
+                waiting.push(neighbor);
+            }
+        }
+    }
+
+    return -1;
+}
+
+
+/********************************************************************
+** Function: plainAStar: Finds the fewest steps between two cells
+ *              with A* on a binary heap, stepping one cell at a time.
+** Params:   const vector<unsigned char> &blocked: 1 for each cell
+ *              that can't be walked on, row by row.
+ *           int size: number of rows and columns.
+ *           int start: cell to start at.
+ *           int goal: cell to get to.
+ *           vector<int> &steps: steps of each cell, reused.
+ *           long &looked: set to the cells taken off the heap.
+** Returns:  int: number of steps, or -1.
+*********************************************************************/
+static int plainAStar(const std::vector<unsigned char> &blocked, int size,
+                      int start, int goal, std::vector<int> &steps, long &looked)
+{
+    std::priority_queue<Waiting, std::vector<Waiting>, std::greater<Waiting> > heap;
+    const int GOAL_X = goal % size;
+    const int GOAL_Y = goal / size;
+
+    steps.assign(blocked.size(), -1);
+    steps[start] = 0;
+    heap.push(Waiting(std::abs(start % size - GOAL_X) + std::abs(start / size - GOAL_Y), start));
+    looked = 0;
+
+    while (!heap.empty())
+    {
+        Waiting top = heap.top();
+        heap.pop();
+
+        int here = top.second;
+        int x = here % size;
+        int y = here / size;
+
+        //it was reached in fewer steps after it was queued
+        if (top.first != steps[here] + std::abs(x - GOAL_X) + std::abs(y - GOAL_Y))
+        {
+            continue;
+        }
+        looked++;
+
+        if (here == goal)
+        {
+            return steps[here];
+        }
+
+        const int NEIGHBOR_X[] = {x, x + 1, x, x - 1};
+        const int NEIGHBOR_Y[] = {y - 1, y, y + 1, y};
+
+        for (int k=0; k<4; k++)
+        {
+            if (NEIGHBOR_X[k] < 0 || NEIGHBOR_X[k] >= size
+                || NEIGHBOR_Y[k] < 0 || NEIGHBOR_Y[k] >= size)
+            {
+                continue;
+            }
+
+            int neighbor = NEIGHBOR_Y[k] * size + NEIGHBOR_X[k];
+            int total = steps[here] + 1;
+            if (!blocked[neighbor] && (steps[neighbor] == -1 || total < steps[neighbor]))
+            {
+                steps[neighbor] = total;
+                heap.push(Waiting(total + std::abs(NEIGHBOR_X[k] - GOAL_X)
+                                  + std::abs(NEIGHBOR_Y[k] - GOAL_Y), neighbor));
+            }
+        }
+    }
+
+    return -1;
+}
+
+
+/********************************************************************
+** Function: run: Times the three searches on one board size and
+ *              prints one row of the results table.
+** Params:   int size: number of rows and columns.
+ *           int trips: number of trips to find.
+** Returns:  None
+*********************************************************************/
+static void run(int size, int trips)
+{
+    BlockerMap blockers(size, size);
+    std::vector<unsigned char> blocked(static_cast<std::size_t>(size) * size, 0);
+
+    //about a tenth of the board is blocked, in fields up to 20 wide
+    long fields = static_cast<long>(size) * size / 1000;
+    for (long i=0; i<fields; i++)
+    {
+        int left = std::rand() % size;
+        int top = std::rand() % size;
+        int width = 1 + std::rand() % 20;
+        int height = 1 + std::rand() % 20;
+
+        for (int y=top; y<top + height && y<size; y++)
+        {
+            for (int x=left; x<left + width && x<size; x++)
+            {
+                blocked[static_cast<std::size_t>(y) * size + x] = 1;
+            }
+        }
+    }
+    for (int y=0; y<size; y++)
+    {
+        for (int x=0; x<size; x++)
+        {
+            blockers.setBlocked(x, y, blocked[static_cast<std::size_t>(y) * size + x]);
+        }
+    }
+
+    JumpPointSearch jumps(blockers);
+    std::vector<int> steps;
+    double seconds[3] = {0, 0, 0};
+    double looked[3] = {0, 0, 0};
+    long mismatches = 0;
+
+    for (int i=0; i<trips; i++)
+    {
+        int from = 0;
+        int to = 0;
+        do
+        {
+            from = std::rand() % (size * size);
+            to = std::rand() % (size * size);
+        } while (blocked[from] || blocked[to]);
+
+        long count = 0;
+        Clock::time_point begin = Clock::now();
+        int found_bfs = breadthFirst(blocked, size, from, to, steps, count);
+        seconds[0] += secondsSince(begin);
+        looked[0] += count;
+
+        begin = Clock::now();
+        int found_astar = plainAStar(blocked, size, from, to, steps, count);
+        seconds[1] += secondsSince(begin);
+        looked[1] += count;
+
+        begin = Clock::now();
+        int found_jps = jumps.search(from % size, from / size, to % size, to / size);
+        seconds[2] += secondsSince(begin);
+        looked[2] += jumps.expandedCount();
+
+        mismatches += (found_astar != found_bfs) + (found_jps != found_bfs);
+    }
+
+    cout << std::left << setw(12)
+         << (std::to_string(size) + "x" + std::to_string(size)) << std::right
+         << std::fixed << std::setprecision(2);
+    for (int k=0; k<3; k++)
+    {
+        cout << setw(11) << (seconds[k] * 1e3 / trips)
+             << setw(12) << std::setprecision(0) << (looked[k] / trips)
+             << std::setprecision(2);
+    }
+    cout << setw(12) << mismatches << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    int trips = (argc > 1) ? std::atoi(argv[1]) : 20;
+
+    if (trips < 1)
+    {
+        std::cerr << "Usage: bench_jps [trips per size]" << endl;
+        return 1;
+    }
+
+    const int SIZES[] = {256, 1024, 4096};
+    const int SIZES_COUNT = 3;
+
+    std::srand(12345);
+
+    cout << trips << " trips per board, time in ms and cells or jump points looked past" << endl;
+    cout << std::left << setw(12) << "board" << std::right
+         << setw(11) << "bfs ms" << setw(12) << "bfs cells"
+         << setw(11) << "a* ms" << setw(12) << "a* cells"
+         << setw(11) << "jps ms" << setw(12) << "jps points"
+         << setw(12) << "mismatches" << endl;
+
+    for (int i=0; i<SIZES_COUNT; i++)
+    {
+        run(SIZES[i], trips);
+    }
+
+    return 0;
+}
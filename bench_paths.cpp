@@ -0,0 +1,199 @@
+/*********************************************************************
+** Program name: bench_paths.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 25, 2019 at 10:05 AM
+** Description: Weighted pathfinding benchmark for Space Escape.
+ *              Fills boards from 256x256 up to 4096x4096 with random
+ *              space types, each cell costing the oxygen of its type,
+ *              and finds the oxygen from the middle of the board to
+ *              every cell, once with a CostField and once with
+ *              Dijkstra's algorithm on a binary heap. Reports the
+ *              time per search for both and checks that they agree
+ *              on every cell.
+ *              Usage: bench_paths [searches per size]
+ *              (default: 3 searches)
+*********************************************************************/
+
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <queue>
+#include <utility>
+#include <vector>
+#include "CostField.hpp"
+#include "GameDefaults.hpp"
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef std::chrono::steady_clock Clock;
+
+//a cell waiting in the heap, with the oxygen it was queued at
+typedef std::pair<int, int> Waiting;
+
+/********************************************************************
+** Function: secondsSince: Returns the time since a starting point.
+** Params:   Clock::time_point begin: starting point.
+** Returns:  double: seconds since begin.
+*********************************************************************/
+static double secondsSince(Clock::time_point begin)
+{
+    return std::chrono::duration<double>(Clock::now() - begin).count();
+}
+
+
+/********************************************************************
+** Function: heapSearch: Finds the oxygen from a cell to every other
+ *              cell with Dijkstra's algorithm on a binary heap, as a
+ *              game without a bucket queue would.
+** Params:   const vector<int> &costs: oxygen cost of each cell, row
+ *              by row, 0 for cells that can't be walked on.
+ *           int rows: number of rows.
+ *           int cols: number of columns.
+ *           int start: cell to start at.
+ *           vector<int> &distances: set to the oxygen of each cell,
+ *              -1 for cells that can't be reached.
+** Returns:  None
+*********************************************************************/
+static void heapSearch(const std::vector<int> &costs, int rows, int cols,
+                       int start, std::vector<int> &distances)
+{
+    std::priority_queue<Waiting, std::vector<Waiting>, std::greater<Waiting> > heap;
+
+    distances.assign(costs.size(), -1);
+    distances[start] = 0;
+    heap.push(Waiting(0, start));
+
+    while (!heap.empty())
+    {
+        Waiting top = heap.top();
+        heap.pop();
+
+        int here = top.second;
+        if (top.first != distances[here])
+        {
+            continue;
+        }
+
+        int x = here % cols;
+        int y = here / cols;
+        const int NEIGHBOR_X[] = {x, x + 1, x, x - 1};
+        const int NEIGHBOR_Y[] = {y - 1, y, y + 1, y};
+
+        for (int k=0; k<4; k++)
+        {
+            if (NEIGHBOR_X[k] < 0 || NEIGHBOR_X[k] >= cols
+                || NEIGHBOR_Y[k] < 0 || NEIGHBOR_Y[k] >= rows)
+            {
+                continue;
+            }
+
+            int neighbor = NEIGHBOR_Y[k] * cols + NEIGHBOR_X[k];
+            int total = top.first + costs[neighbor];
+            if (costs[neighbor] && (distances[neighbor] == -1 || total < distances[neighbor]))
+            {
+                distances[neighbor] = total;
+                heap.push(Waiting(total, neighbor));
+            }
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: run: Times both searches on one board size and prints
+ *              one row of the results table.
+** Params:   int size: number of rows and columns.
+ *           int searches: number of searches of each kind.
+** Returns:  None
+*********************************************************************/
+static void run(int size, int searches)
+{
+    CostField field(size, size);
+    std::vector<int> costs(static_cast<std::size_t>(size) * size);
+
+    //every cell gets a random space type, craters cost more and
+    // chasms can't be crossed
+    for (int y=0; y<size; y++)
+    {
+        for (int x=0; x<size; x++)
+        {
+            int type = std::rand() % GameDefaults::DEFAULTSPACE;
+            int cost = SPACE_CONFIG_LT[type].passable ? SPACE_CONFIG_LT[type].oxygen_cost : 0;
+
+            field.setCost(x, y, cost);
+            costs[y * size + x] = cost;
+        }
+    }
+
+    //both searches start in the middle, which has to be open
+    field.setCost(size / 2, size / 2, 1);
+    costs[(size / 2) * size + size / 2] = 1;
+
+    Clock::time_point begin = Clock::now();
+    for (int i=0; i<searches; i++)
+    {
+        field.search(size / 2, size / 2);
+    }
+    double bucket_seconds = secondsSince(begin) / searches;
+
+    std::vector<int> distances;
+    begin = Clock::now();
+    for (int i=0; i<searches; i++)
+    {
+        heapSearch(costs, size, size, (size / 2) * size + size / 2, distances);
+    }
+    double heap_seconds = secondsSince(begin) / searches;
+
+    //both have to find the same oxygen for every cell
+    long mismatches = 0;
+    for (int y=0; y<size; y++)
+    {
+        for (int x=0; x<size; x++)
+        {
+            mismatches += (field.distance(x, y) != distances[y * size + x]);
+        }
+    }
+
+    cout << std::left << setw(12)
+         << (std::to_string(size) + "x" + std::to_string(size)) << std::right
+         << std::fixed << std::setprecision(2)
+         << setw(14) << (bucket_seconds * 1e3)
+         << setw(14) << (heap_seconds * 1e3)
+         << setw(10) << (heap_seconds / bucket_seconds)
+         << setw(12) << mismatches << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    int searches = (argc > 1) ? std::atoi(argv[1]) : 3;
+
+    if (searches < 1)
+    {
+        std::cerr << "Usage: bench_paths [searches per size]" << endl;
+        return 1;
+    }
+
+    const int SIZES[] = {256, 1024, 4096};
+    const int SIZES_COUNT = 3;
+
+    std::srand(12345);
+
+    cout << searches << " searches per board" << endl;
+    cout << std::left << setw(12) << "board" << std::right
+         << setw(14) << "bucket ms"
+         << setw(14) << "heap ms"
+         << setw(10) << "speedup"
+         << setw(12) << "mismatches" << endl;
+
+    for (int i=0; i<SIZES_COUNT; i++)
+    {
+        run(SIZES[i], searches);
+    }
+
+    return 0;
+}
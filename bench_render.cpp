@@ -0,0 +1,124 @@
+/*********************************************************************
+** Program name: bench_render.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 12, 2019 at 4:15 PM
+** Description: Rendering throughput benchmark for Space Escape.
+ *              Renders boards from 10x10 up to 4096x4096 into a
+ *              MemorySink and reports frames per second and bytes
+ *              per frame for each size, followed by the full game
+ *              screen from Game::print. Boards are TiledBoards, so
+ *              large boards fit in memory.
+ *              Usage: bench_render [seconds per size] [theme]
+ *              (defaults: 0.5 seconds, plain theme)
+*********************************************************************/
+
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "MemorySink.hpp"
+#include "TiledBoard.hpp"
+#include "Game.hpp"
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef std::chrono::steady_clock Clock;
+
+/********************************************************************
+** Function: report: Prints one row of the results table.
+** Params:   const char *label: name of what was rendered.
+ *           long frames: number of frames rendered.
+ *           double seconds: total time spent rendering.
+ *           size_t bytes: bytes in a single frame.
+** Returns:  None
+*********************************************************************/
+static void report(const char *label, long frames, double seconds,
+        std::size_t bytes)
+{
+    double fps = frames / seconds;
+
+    cout << std::left << setw(14) << label << std::right
+         << setw(10) << frames
+         << setw(14) << std::fixed << std::setprecision(1) << fps
+         << setw(16) << bytes
+         << setw(12) << std::setprecision(1)
+         << (fps * bytes) / (1024.0 * 1024.0) << endl;
+}
+
+
+int main(int argc, char *argv[])
+{
+    //time to spend rendering each board size
+    double budget = (argc > 1) ? std::atof(argv[1]) : 0.5;
+
+    //theme to color the board with
+    const Theme *theme = Theme::find((argc > 2) ? argv[2] : "plain");
+    if (!theme)
+    {
+        std::cerr << "Unknown theme: " << argv[2] << endl;
+        return 1;
+    }
+
+    const int SIZES[] = {10, 32, 100, 256, 1024, 4096};
+    const int SIZES_COUNT = 6;
+
+    cout << std::left << setw(14) << "board" << std::right
+         << setw(10) << "frames"
+         << setw(14) << "frames/sec"
+         << setw(16) << "bytes/frame"
+         << setw(12) << "MB/sec" << endl;
+
+    for (int i=0; i<SIZES_COUNT; i++)
+    {
+        int size = SIZES[i];
+        TiledBoard tiled(size, size);
+        Board &board = tiled.getBoard();
+        board.setTheme(theme);
+
+        //render one frame up front so the sink is at full size
+        MemorySink sink;
+        board.print(size / 2, size / 2, Human::DEFAULT_ICON, sink);
+        std::size_t bytes = sink.size();
+
+        long frames = 0;
+        double seconds = 0.0;
+        Clock::time_point begin = Clock::now();
+
+        while (seconds < budget)
+        {
+            sink.reset();
+            board.print(size / 2, size / 2, Human::DEFAULT_ICON, sink);
+            frames++;
+            seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+        }
+
+        std::string label = std::to_string(size) + "x" + std::to_string(size);
+        report(label.c_str(), frames, seconds, bytes);
+    }
+
+    //the complete game screen: status, map, legend, and borders
+    Game game;
+    game.setTheme(theme);
+    MemorySink sink;
+    game.print(sink);
+    std::size_t bytes = sink.size();
+
+    long frames = 0;
+    double seconds = 0.0;
+    Clock::time_point begin = Clock::now();
+
+    while (seconds < budget)
+    {
+        sink.reset();
+        game.print(sink);
+        frames++;
+        seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+    }
+
+    report("Game::print", frames, seconds, bytes);
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*********************************************************************
+** Program name: bench_teleport.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 23, 2019 at 3:20 PM
+** Description: Worm hole destination benchmark for Space Escape.
+ *              Builds a TeleportTable for boards from 10x10 up to
+ *              2048x2048, once with every space type equally likely
+ *              and once with craters four times as likely and the
+ *              rocket ship left out, and reports how long building
+ *              and picking take. To check the picks are fair, it
+ *              also reports the largest difference between how often
+ *              each space type was picked and how often it should
+ *              have been. Boards are TiledBoards, so large boards fit
+ *              in memory.
+ *              Usage: bench_teleport [picks per size]
+ *              (default: 2000000 picks)
+*********************************************************************/
+
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "TiledBoard.hpp"
+#include "TeleportTable.hpp"
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef std::chrono::steady_clock Clock;
+
+/********************************************************************
+** Function: secondsSince: Returns the time since a starting point.
+** Params:   Clock::time_point begin: starting point.
+** Returns:  double: seconds since begin.
+*********************************************************************/
+static double secondsSince(Clock::time_point begin)
+{
+    return std::chrono::duration<double>(Clock::now() - begin).count();
+}
+
+
+/********************************************************************
+** Function: run: Builds a table for a board, picks from it, and
+ *              prints one row of the results table.
+** Params:   const Board &board: board to pick cells from.
+ *           const int *weights: weight of each space type.
+ *           const char *label: name of the weights.
+ *           long picks: number of cells to pick.
+** Returns:  None
+*********************************************************************/
+static void run(const Board &board, const int *weights, const char *label, long picks)
+{
+    TeleportTable table(12345);
+    for (int type=0; type<TeleportTable::TYPE_COUNT; type++)
+    {
+        table.setWeight(static_cast<SpaceType>(type), weights[type]);
+    }
+
+    Clock::time_point begin = Clock::now();
+    table.build(board);
+    double build_seconds = secondsSince(begin);
+
+    //how many picks should land on each type
+    double expected[TeleportTable::TYPE_COUNT] = {0};
+    double total = 0;
+    for (int y=0; y<board.getRows(); y++)
+    {
+        for (int x=0; x<board.getCols(); x++)
+        {
+            expected[board.getType(x, y)] += weights[board.getType(x, y)];
+            total += weights[board.getType(x, y)];
+        }
+    }
+
+    long counts[TeleportTable::TYPE_COUNT] = {0};
+    int x = 0;
+    int y = 0;
+    begin = Clock::now();
+    for (long i=0; i<picks; i++)
+    {
+        table.pick(x, y);
+        counts[board.getType(x, y)]++;
+    }
+    double pick_seconds = secondsSince(begin);
+
+    //largest difference, as a share of all picks
+    double worst = 0;
+    for (int type=0; type<TeleportTable::TYPE_COUNT; type++)
+    {
+        double difference = std::fabs(static_cast<double>(counts[type]) / picks
+                                      - expected[type] / total);
+        worst = (difference > worst) ? difference : worst;
+    }
+
+    cout << std::left << setw(12)
+         << (std::to_string(board.getCols()) + "x" + std::to_string(board.getRows()))
+         << setw(10) << label << std::right
+         << std::fixed << std::setprecision(2)
+         << setw(12) << (build_seconds * 1e3)
+         << setw(12) << (pick_seconds * 1e9 / picks)
+         << setw(12) << std::setprecision(4) << (worst * 100) << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    long picks = (argc > 1) ? std::atol(argv[1]) : 2000000;
+
+    if (picks < 1)
+    {
+        std::cerr << "Usage: bench_teleport [picks per size]" << endl;
+        return 1;
+    }
+
+    const int SIZES[] = {10, 100, 1000, 2048};
+    const int SIZES_COUNT = 4;
+
+    //weights by SpaceType: rocket ship, crater, space rock, worm hole,
+    // ground, empty
+    const int EVEN[] = {1, 1, 1, 1, 1, 0};
+    const int WEIGHTED[] = {0, 4, 1, 1, 1, 0};
+
+    cout << picks << " picks per board" << endl;
+    cout << std::left << setw(12) << "board" << setw(10) << "weights" << std::right
+         << setw(12) << "build ms"
+         << setw(12) << "ns/pick"
+         << setw(12) << "off by %" << endl;
+
+    for (int i=0; i<SIZES_COUNT; i++)
+    {
+        TiledBoard tiled(SIZES[i], SIZES[i]);
+        run(tiled.getBoard(), EVEN, "even", picks);
+        run(tiled.getBoard(), WEIGHTED, "weighted", picks);
+    }
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+/*********************************************************************
+** Program name: bench_tiles.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 23, 2019 at 10:05 AM
+** Description: Tile change benchmark for Space Escape. Turns square
+ *              areas of ground into craters on a board of ground,
+ *              with a listener that counts the craters on the whole
+ *              board every time it is told about a change, like a
+ *              cache worked out from the board would. Each area is
+ *              changed once as one batch and once as one batch per
+ *              tile, and the time and number of listener calls are
+ *              reported for both.
+ *              Usage: bench_tiles [board size]
+ *              (default: 256)
+*********************************************************************/
+
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "Board.hpp"
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef std::chrono::steady_clock Clock;
+
+//counts the craters on the board every time it changes
+class CraterCount : public BoardListener
+{
+public:
+    long calls;
+    int craters;
+
+    CraterCount() : calls(0), craters(0) {}
+
+    virtual void tilesChanged(const Board &board, int left, int top,
+                              int right, int bottom) override
+    {
+        calls++;
+        craters = 0;
+        for (int y=0; y<board.getRows(); y++)
+        {
+            for (int x=0; x<board.getCols(); x++)
+            {
+                craters += (board.getType(x, y) == CRATER);
+            }
+        }
+    }
+};
+
+/********************************************************************
+** Function: secondsSince: Returns the time since a starting point.
+** Params:   Clock::time_point begin: starting point.
+** Returns:  double: seconds since begin.
+*********************************************************************/
+static double secondsSince(Clock::time_point begin)
+{
+    return std::chrono::duration<double>(Clock::now() - begin).count();
+}
+
+
+/********************************************************************
+** Function: fillGround: Fills every cell of a board with ground and
+ *              links the spaces.
+** Params:   Board &board: board to fill.
+** Returns:  None
+*********************************************************************/
+static void fillGround(Board &board)
+{
+    for (int y=0; y<board.getRows(); y++)
+    {
+        for (int x=0; x<board.getCols(); x++)
+        {
+            delete board.getSpace(x, y);
+            board.setSpace(x, y, SpaceFactory::create(x, y, GROUND));
+        }
+    }
+    board.linkSpaces();
+}
+
+int main(int argc, char *argv[])
+{
+    int size = (argc > 1) ? std::atoi(argv[1]) : 256;
+
+    if (size < 8)
+    {
+        std::cerr << "Usage: bench_tiles [board size of at least 8]" << endl;
+        return 1;
+    }
+
+    const int AREAS[] = {4, 16, 64};
+    const int AREAS_COUNT = 3;
+
+    Board board(size, size);
+    CraterCount counter;
+    board.addListener(&counter);
+
+    cout << size << "x" << size << " board" << endl;
+    cout << std::left << setw(10) << "area" << setw(16) << "batches" << std::right
+         << setw(12) << "ms"
+         << setw(12) << "calls"
+         << setw(12) << "craters" << endl;
+
+    for (int i=0; i<AREAS_COUNT; i++)
+    {
+        int area = (AREAS[i] < size) ? AREAS[i] : size;
+        std::string name = std::to_string(area) + "x" + std::to_string(area);
+        TileBatch batch;
+
+        //the whole area as one batch
+        fillGround(board);
+        counter.calls = 0;
+        Clock::time_point begin = Clock::now();
+        batch.convert(0, 0, area - 1, area - 1, GROUND, CRATER);
+        board.apply(batch);
+        double seconds = secondsSince(begin);
+
+        cout << std::left << setw(10) << name << setw(16) << "one" << std::right
+             << std::fixed << std::setprecision(2)
+             << setw(12) << (seconds * 1e3)
+             << setw(12) << counter.calls
+             << setw(12) << counter.craters << endl;
+
+        //one batch per tile
+        fillGround(board);
+        counter.calls = 0;
+        begin = Clock::now();
+        for (int y=0; y<area; y++)
+        {
+            for (int x=0; x<area; x++)
+            {
+                batch.clear();
+                batch.setType(x, y, CRATER);
+                board.apply(batch);
+            }
+        }
+        seconds = secondsSince(begin);
+
+        cout << std::left << setw(10) << name << setw(16) << "one per tile" << std::right
+             << std::fixed << std::setprecision(2)
+             << setw(12) << (seconds * 1e3)
+             << setw(12) << counter.calls
+             << setw(12) << counter.craters << endl;
+    }
+
+    //the board doesn't own its spaces
+    for (int y=0; y<size; y++)
+    {
+        for (int x=0; x<size; x++)
+        {
+            delete board.getSpace(x, y);
+        }
+    }
+
+    return 0;
+}
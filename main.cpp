@@ -1,4 +1,3 @@
-
 /*********************************************************************
 ** Program name: main.cpp
 ** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
@@ -6,18 +5,139 @@
 ** Description: Main is the driver function for the Space Escape game.
  *              It creates an instance of the Game driver class, then
  *              starts the game by calling the start function.
+ *              Options:
+ *                --fog [radius]   only show explored parts of the map
+ *                --theme name     color the map: plain, classic or
+ *                                 contrast
+ *                --script file    play the moves in the file without
+ *                                 prompts and print a summary
+ *                --raw            single key input: WASD or arrows
+ *                                 move, c check, i inventory, q quit
+ *                --aliens count   let aliens roam the asteroid
+ *                --hunt           roaming aliens hunt you down
+ *                --respawn steps  aliens that ran away come back to
+ *                                 hide after this many steps
+ *                --leak steps     your suit loses one oxygen point
+ *                                 every this many steps
+ *                --meteors steps  a meteor shower hits every this
+ *                                 many steps
+ *                --linked         worm holes lead to each other
 *********************************************************************/
 
 
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <string>
 #include "Game.hpp"
 
-int main() {
+int main(int argc, char *argv[]) {
 
     //create game object
     Game space_escape;
 
-    //start the game
-    space_escape.start();
+    //script to play instead of the menus, if any
+    std::ifstream script;
+
+    //apply command line options
+    for (int i=1; i<argc; i++)
+    {
+        std::string option = argv[i];
+
+        if (option == "--fog")
+        {
+            //radius is optional
+            int radius = FogOfWar::DEFAULT_RADIUS;
+            if (i+1 < argc && std::isdigit(static_cast<unsigned char>(argv[i+1][0])))
+            {
+                radius = std::atoi(argv[++i]);
+            }
+            space_escape.enableFogOfWar(radius);
+        }
+        else if (option == "--theme" && i+1 < argc)
+        {
+            const Theme *theme = Theme::find(argv[++i]);
+            if (!theme)
+            {
+                std::cerr << "Unknown theme: " << argv[i] << std::endl;
+                return 1;
+            }
+            space_escape.setTheme(theme);
+        }
+        else if (option == "--raw")
+        {
+            //fall back to the menus if input isn't a terminal
+            if (!space_escape.enableRawInput())
+            {
+                std::cerr << "--raw needs a terminal, using the menus" << std::endl;
+            }
+        }
+        else if (option == "--aliens" && i+1 < argc)
+        {
+            int count = std::atoi(argv[++i]);
+            if (count < 0)
+            {
+                std::cerr << "Alien count can't be negative" << std::endl;
+                return 1;
+            }
+            space_escape.enableAliens(count);
+        }
+        else if (option == "--hunt")
+        {
+            space_escape.enableHunting();
+        }
+        else if (option == "--linked")
+        {
+            space_escape.enableLinkedWormholes();
+        }
+        else if ((option == "--respawn" || option == "--leak" || option == "--meteors")
+                 && i+1 < argc)
+        {
+            int steps = std::atoi(argv[++i]);
+            if (steps < 1)
+            {
+                std::cerr << option << " needs a number of steps" << std::endl;
+                return 1;
+            }
+
+            if (option == "--respawn")
+            {
+                space_escape.enableRespawn(steps);
+            }
+            else if (option == "--leak")
+            {
+                space_escape.enableOxygenLeak(steps);
+            }
+            else
+            {
+                space_escape.enableMeteors(steps);
+            }
+        }
+        else if (option == "--script" && i+1 < argc)
+        {
+            script.open(argv[++i]);
+            if (!script)
+            {
+                std::cerr << "Could not open script: " << argv[i] << std::endl;
+                return 1;
+            }
+        }
+        else
+        {
+            std::cerr << "Unknown option: " << option << std::endl;
+            return 1;
+        }
+    }
+
+    //start the game, or play the script
+    if (script.is_open())
+    {
+        space_escape.runScript(script);
+    }
+    else
+    {
+        space_escape.start();
+    }
 
     return 0;
 }
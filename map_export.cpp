@@ -0,0 +1,77 @@
+/*********************************************************************
+** Program name: map_export.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Jun 14, 2019 at 11:05 AM
+** Description: Map export tool for Space Escape. Writes the level to
+ *              a run-length encoded text dump and a PPM image with
+ *              one pixel per tile, using MapExport.
+ *              Usage: map_export [--tile SIZE] <map.rle> <map.ppm>
+ *              By default the game's level is exported, with its
+ *              hidden aliens and items. With --tile, a SIZE x SIZE
+ *              TiledBoard is exported instead.
+*********************************************************************/
+
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "MapExport.hpp"
+#include "TiledBoard.hpp"
+#include "Game.hpp"
+
+using std::cerr;
+using std::endl;
+using std::string;
+
+/********************************************************************
+** Function: exportBoard: Writes the board to both files.
+** Params:   const Board &board: board to export.
+ *           const char *rle_path: path of the RLE dump.
+ *           const char *ppm_path: path of the PPM image.
+** Returns:  int: exit status, 0 on success.
+*********************************************************************/
+static int exportBoard(const Board &board, const char *rle_path, const char *ppm_path)
+{
+    std::ofstream rle(rle_path);
+    std::ofstream ppm(ppm_path, std::ios::binary);
+
+    if (!rle || !ppm)
+    {
+        cerr << "Error: could not open output files." << endl;
+        return 1;
+    }
+
+    MapExport::writeRLE(board, rle);
+    MapExport::writePPM(board, ppm);
+
+    return (rle && ppm) ? 0 : 1;
+}
+
+
+int main(int argc, char *argv[])
+{
+    int tile_size = 0;
+    int arg = 1;
+
+    if (arg < argc && string(argv[arg]) == "--tile" && arg + 1 < argc)
+    {
+        tile_size = std::atoi(argv[arg + 1]);
+        arg += 2;
+    }
+
+    if (argc - arg != 2 || (arg > 1 && tile_size < 1))
+    {
+        cerr << "Usage: " << argv[0] << " [--tile SIZE] <map.rle> <map.ppm>" << endl;
+        return 1;
+    }
+
+    if (tile_size > 0)
+    {
+        TiledBoard tiled(tile_size, tile_size);
+        return exportBoard(tiled.getBoard(), argv[arg], argv[arg + 1]);
+    }
+
+    Game game;
+    return exportBoard(*game.getBoard(), argv[arg], argv[arg + 1]);
+}